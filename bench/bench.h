@@ -0,0 +1,208 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// A small timing harness for grad_bench.
+//
+// Each benchmark is warmed up, then timed for a number of repetitions.
+// Every repetition runs as many calls as fit in the minimum sample time,
+// so cheap calls are not lost in clock resolution. The median repetition
+// is reported per call, per operation and as bytes per second.
+
+// Keeps the compiler from discarding a result that is never read.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+struct BenchConfig {
+  double warmup_ms;
+  double min_sample_ms;
+  size_t repetitions;
+  const char* filter;  // only run benchmarks whose name contains this
+};
+
+struct BenchCase {
+  const char* name;
+  size_t size;   // elements, vertexes or similar, as suits the benchmark
+  double ops;    // operations per call
+  double bytes;  // bytes read and written per call
+};
+
+struct BenchResult {
+  BenchCase bench;
+  size_t calls_per_sample;
+  double median_ns;  // per call
+  double min_ns;
+  double max_ns;
+};
+
+enum BenchFormat {
+  BENCH_TEXT,
+  BENCH_CSV,
+  BENCH_JSON,
+};
+
+class BenchRunner {
+public:
+  explicit BenchRunner(const BenchConfig& config);
+
+  bool enabled(const char* name) const;
+
+  // Times call(), which may be run many times per sample.
+  template <typename Call>
+  void run(const BenchCase& bench, Call call);
+
+  // Calls setup() before every timed call(), outside the timing. For calls
+  // that consume their input, one call is timed per sample.
+  template <typename Setup, typename Call>
+  void run_with_setup(const BenchCase& bench, Setup setup, Call call);
+
+  void print(BenchFormat format) const;
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  static double elapsed_ns(Clock::time_point begin, Clock::time_point end);
+  void add_result(const BenchCase& bench, size_t calls, std::vector<double>* samples);
+
+private:
+  BenchConfig config_;
+  std::vector<BenchResult> results_;
+};
+
+inline BenchRunner::BenchRunner(const BenchConfig& config)
+  : config_(config)
+{}
+
+inline bool BenchRunner::enabled(const char* name) const {
+  return !config_.filter || strstr(name, config_.filter);
+}
+
+inline double BenchRunner::elapsed_ns(Clock::time_point begin, Clock::time_point end) {
+  return std::chrono::duration<double, std::nano>(end - begin).count();
+}
+
+template <typename Call>
+void BenchRunner::run(const BenchCase& bench, Call call) {
+  if (!enabled(bench.name)) {
+    return;
+  }
+
+  // warm up, and find how many calls make up one sample
+  size_t calls = 0;
+  Clock::time_point begin = Clock::now();
+  double spent_ns = 0;
+  do {
+    call();
+    ++calls;
+    spent_ns = elapsed_ns(begin, Clock::now());
+  } while (spent_ns < config_.warmup_ms * 1e6);
+  double per_call_ns = spent_ns / calls;
+  size_t calls_per_sample = std::max<size_t>(1,
+    (size_t)(config_.min_sample_ms * 1e6 / per_call_ns));
+
+  std::vector<double> samples;
+  for (size_t r = 0; r < config_.repetitions; ++r) {
+    Clock::time_point sample_begin = Clock::now();
+    for (size_t i = 0; i < calls_per_sample; ++i) {
+      call();
+    }
+    samples.push_back(elapsed_ns(sample_begin, Clock::now()) / calls_per_sample);
+  }
+  add_result(bench, calls_per_sample, &samples);
+}
+
+template <typename Setup, typename Call>
+void BenchRunner::run_with_setup(const BenchCase& bench, Setup setup, Call call) {
+  if (!enabled(bench.name)) {
+    return;
+  }
+
+  Clock::time_point begin = Clock::now();
+  do {
+    setup();
+    call();
+  } while (elapsed_ns(begin, Clock::now()) < config_.warmup_ms * 1e6);
+
+  std::vector<double> samples;
+  for (size_t r = 0; r < config_.repetitions; ++r) {
+    setup();
+    Clock::time_point sample_begin = Clock::now();
+    call();
+    samples.push_back(elapsed_ns(sample_begin, Clock::now()));
+  }
+  add_result(bench, 1, &samples);
+}
+
+inline void BenchRunner::add_result(const BenchCase& bench, size_t calls,
+    std::vector<double>* samples) {
+  std::sort(samples->begin(), samples->end());
+  size_t n = samples->size();
+  BenchResult result;
+  result.bench = bench;
+  result.calls_per_sample = calls;
+  result.median_ns = n % 2 ? (*samples)[n / 2]
+    : ((*samples)[n / 2 - 1] + (*samples)[n / 2]) / 2;
+  result.min_ns = samples->front();
+  result.max_ns = samples->back();
+  results_.push_back(result);
+
+  fprintf(stderr, "%-34s %8zu %12.1f ns\n", bench.name, bench.size, result.median_ns);
+}
+
+inline void BenchRunner::print(BenchFormat format) const {
+#ifdef NDEBUG
+  const char* build = "release";
+#else
+  const char* build = "debug";
+#endif
+
+  if (format == BENCH_JSON) {
+    printf("{\n  \"build\": \"%s\",\n  \"repetitions\": %zu,\n  \"results\": [\n",
+      build, config_.repetitions);
+  } else if (format == BENCH_CSV) {
+    printf("name,size,calls_per_sample,median_ns,min_ns,max_ns,ns_per_op,bytes_per_s\n");
+  } else {
+    printf("%s build, median of %zu repetitions\n", build, config_.repetitions);
+    printf("%-34s %8s %14s %12s %14s\n",
+      "benchmark", "size", "ns/call", "ns/op", "MB/s");
+  }
+
+  for (size_t i = 0; i < results_.size(); ++i) {
+    const BenchResult& r = results_[i];
+    double ns_per_op = r.median_ns / r.bench.ops;
+    double bytes_per_s = r.bench.bytes / (r.median_ns * 1e-9);
+    if (format == BENCH_JSON) {
+      printf("    {\"name\": \"%s\", \"size\": %zu, \"calls_per_sample\": %zu, "
+        "\"median_ns\": %.3f, \"min_ns\": %.3f, \"max_ns\": %.3f, "
+        "\"ns_per_op\": %.4f, \"bytes_per_s\": %.0f}%s\n",
+        r.bench.name, r.bench.size, r.calls_per_sample,
+        r.median_ns, r.min_ns, r.max_ns, ns_per_op, bytes_per_s,
+        i + 1 < results_.size() ? "," : "");
+    } else if (format == BENCH_CSV) {
+      printf("%s,%zu,%zu,%.3f,%.3f,%.3f,%.4f,%.0f\n",
+        r.bench.name, r.bench.size, r.calls_per_sample,
+        r.median_ns, r.min_ns, r.max_ns, ns_per_op, bytes_per_s);
+    } else {
+      printf("%-34s %8zu %14.1f %12.3f %14.1f\n",
+        r.bench.name, r.bench.size, r.median_ns, ns_per_op, bytes_per_s / 1e6);
+    }
+  }
+
+  if (format == BENCH_JSON) {
+    printf("  ]\n}\n");
+  }
+}
+
+#endif
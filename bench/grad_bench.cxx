@@ -0,0 +1,1559 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bench/bench.h"
+#include "math/mat4f.h"
+#include "math/quaternion.h"
+#include "math/vec.h"
+#include "math/vec3f.h"
+#include "math/vec3f_x.h"
+#include "math/vec4f.h"
+#include "math/vector_math.h"
+#include "misc/colormap.h"
+#include "misc/cpu_dispatch.h"
+#include "misc/field_eval.h"
+#include "misc/kernels.h"
+#include "misc/quaternion_batch.h"
+#include "misc/scene_graph.h"
+#include "misc/thread_pool.h"
+#include "opengl/mesh.h"
+#include "opengl/mesh_transform.h"
+#include "opengl/sample_models.h"
+
+namespace {
+  // deterministic values in [-1, 1)
+  struct Random {
+    unsigned state;
+
+    float next() {
+      state = state * 1664525u + 1013904223u;
+      return (state >> 8) * (2.f / 16777216.f) - 1.f;
+    }
+  };
+
+  std::vector<float> random_floats(size_t count, unsigned seed) {
+    Random random = { seed };
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+      values[i] = random.next();
+    }
+    return values;
+  }
+
+  // Unit quaternions, with every fourth one in from its own negation, every
+  // eighth the same as in to and every sixteenth very close to it, so that
+  // interpolating between them takes every branch.
+  void random_keyframes(size_t count, unsigned seed,
+                        std::vector<quaternion>* from, std::vector<quaternion>* to) {
+    std::vector<float> values = random_floats(8 * count, seed);
+    from->resize(count);
+    to->resize(count);
+    for (size_t i = 0; i < count; ++i) {
+      const float* v = &values[8*i];
+      quaternion a = normalized(quaternion(v[0], vec3f(v[1], v[2], v[3])));
+      quaternion b = normalized(quaternion(v[4], vec3f(v[5], v[6], v[7])));
+      if (i % 16 == 15) {
+        b = normalized(a + 1e-3f * b);
+      } else if (i % 8 == 7) {
+        b = a;
+      } else if (i % 4 == 3) {
+        b = -1.f * a;
+      }
+      (*from)[i] = a;
+      (*to)[i] = b;
+    }
+  }
+
+  LocalTransform random_local(Random* random) {
+    LocalTransform t = {
+      vec3f(random->next(), random->next(), random->next()),
+      normalized(quaternion(random->next(), vec3f(random->next(), random->next(),
+                                                  random->next()))),
+      vec3f(1 + 0.1f * random->next(), 1 + 0.1f * random->next(), 1 + 0.1f * random->next()),
+    };
+    return t;
+  }
+
+  // root_count roots, and the rest each under a random earlier node, which
+  // makes a tree a dozen or so levels deep.
+  void add_random_nodes(SceneGraph* graph, size_t count, size_t root_count, Random* random) {
+    for (size_t i = 0; i < count; ++i) {
+      size_t existing = graph->node_count();
+      size_t parent = existing < root_count ? SceneGraph::k_no_parent
+        : (size_t)((random->next() + 1) / 2 * existing) % existing;
+      graph->add_node(parent, random_local(random));
+    }
+  }
+
+  const float* floats(const quaternion* q) {
+    return reinterpret_cast<const float*>(q);
+  }
+  float* floats(quaternion* q) {
+    return reinterpret_cast<float*>(q);
+  }
+
+  // every triangle gets its own copies of its vertexes, so that simplify
+  // has duplicates to merge
+  Mesh unwelded(const Mesh& mesh) {
+    Mesh result;
+    for (size_t i = 0; i < mesh.indexes.size(); ++i) {
+      result.vertexes.push_back(mesh.vertexes[mesh.indexes[i]]);
+      result.indexes.push_back(i);
+    }
+    return result;
+  }
+
+  // The inputs of the view matrix chain in display().
+  struct ViewInputs {
+    float scale;
+    float aspect[2];
+    float pan[2];
+    quaternion orient;
+  };
+
+  std::vector<ViewInputs> random_view_inputs(size_t count, unsigned seed) {
+    std::vector<float> values = random_floats(9 * count, seed);
+    std::vector<ViewInputs> inputs(count);
+    for (size_t i = 0; i < count; ++i) {
+      const float* v = &values[9*i];
+      ViewInputs& in = inputs[i];
+      in.scale = 1.5f + v[0];
+      in.aspect[0] = 1.f;
+      in.aspect[1] = 1.25f + 0.5f * v[1];
+      in.pan[0] = v[2];
+      in.pan[1] = v[3];
+      in.orient = quaternion(v[4], normalized(vec3f(v[5], v[6], v[7] + 2.f)));
+    }
+    return inputs;
+  }
+
+  mat4f view_matrix(const ViewInputs& in) {
+    mat4f p = mat4f::ortho()
+      * mat4f::scale({in.scale, in.scale, in.scale})
+      * mat4f::scale({in.aspect[0], in.aspect[1], 1});
+    mat4f v = mat4f::trans({in.pan[0], in.pan[1], 0})
+      * in.orient.to_mat4f();
+    return p * v;
+  }
+
+  // view_matrix with the plain C++ products
+  mat4f view_matrix_scalar(const ViewInputs& in) {
+    mat4f a, b, p, v, mvp;
+    m4f_mul_m4fo_scalar(mat4f::ortho(), mat4f::scale({in.scale, in.scale, in.scale}), a);
+    m4f_mul_m4fo_scalar(a, mat4f::scale({in.aspect[0], in.aspect[1], 1}), p);
+    m4f_mul_m4fo_scalar(mat4f::trans({in.pan[0], in.pan[1], 0}), in.orient.to_mat4f(), v);
+    m4f_mul_m4fo_scalar(p, v, mvp);
+    return mvp;
+  }
+
+  // view_matrix with a stored matrix per product, as the operators worked
+  // before mat4f_product
+  mat4f view_matrix_stored(const ViewInputs& in) {
+    mat4f a, p, v, mvp;
+    m4f_mul_m4fo(mat4f::ortho(), mat4f::scale({in.scale, in.scale, in.scale}), a);
+    m4f_mul_m4fo(a, mat4f::scale({in.aspect[0], in.aspect[1], 1}), p);
+    m4f_mul_m4fo(mat4f::trans({in.pan[0], in.pan[1], 0}), in.orient.to_mat4f(), v);
+    m4f_mul_m4fo(p, v, mvp);
+    return mvp;
+  }
+
+  // The quaternion product and Box::center written out by hand, one
+  // component at a time, against which the operators should be no slower.
+  quaternion quaternion_product_fused(const quaternion& l, const quaternion& r) {
+    return quaternion(l.s*r.s - (l.v[0]*r.v[0] + l.v[1]*r.v[1] + l.v[2]*r.v[2]),
+      vec3f(l.s*r.v[0] + r.s*l.v[0] + (l.v[1]*r.v[2] - l.v[2]*r.v[1]),
+            l.s*r.v[1] + r.s*l.v[1] + (l.v[2]*r.v[0] - l.v[0]*r.v[2]),
+            l.s*r.v[2] + r.s*l.v[2] + (l.v[0]*r.v[1] - l.v[1]*r.v[0])));
+  }
+
+  vec3f box_center_fused(const Box& box) {
+    return vec3f((box.min_corner[0] + box.max_corner[0]) / 2.f,
+                 (box.min_corner[1] + box.max_corner[1]) / 2.f,
+                 (box.min_corner[2] + box.max_corner[2]) / 2.f);
+  }
+
+  // Largest difference between count floats, relative to the size of the
+  // expected value where that is above 1.
+  float max_error(const float* expected, const float* actual, size_t count) {
+    float worst = 0;
+    for (size_t i = 0; i < count; ++i) {
+      float error = fabsf(expected[i] - actual[i]) / std::max(1.f, fabsf(expected[i]));
+      // NaN wins, so that it fails the check
+      worst = error > worst || std::isnan(error) ? error : worst;
+    }
+    return worst;
+  }
+
+  bool report_check_within(const char* name, float error, float tolerance) {
+    bool ok = error <= tolerance;
+    fprintf(stderr, "check %-28s max error %.3g%s\n", name, error, ok ? "" : "  FAILED");
+    return ok;
+  }
+
+  bool report_check(const char* name, float error) {
+    // a few ulp of the sum of four products of values below 4
+    return report_check_within(name, error, 1e-5f);
+  }
+
+  // The SIMD versions of the vector_math.h kernels and the mat4f operators
+  // against the plain C++ ones.
+  bool check_vector_math() {
+    const size_t count = 4096;
+    std::vector<float> lhs = random_floats(16 * count, 7);
+    std::vector<float> rhs = random_floats(16 * count, 8);
+    float m4f_error = 0, v4f_error = 0, m3f_error = 0, mat4f_error = 0, vec4f_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      const float* m = &lhs[16*i];
+      const float* n = &rhs[16*i];
+      float expected[16], actual[16];
+
+      m4f_mul_m4fo_scalar(m, n, expected);
+      m4f_mul_m4fo(m, n, actual);
+      m4f_error = std::max(m4f_error, max_error(expected, actual, 16));
+
+      m4f_mul_v4fo_scalar(m, n, expected);
+      m4f_mul_v4fo(m, n, actual);
+      v4f_error = std::max(v4f_error, max_error(expected, actual, 4));
+
+      m3f_mul_m3fo_scalar(m, n, expected);
+      m3f_mul_m3fo(m, n, actual);
+      m3f_error = std::max(m3f_error, max_error(expected, actual, 9));
+
+      mat4f a, b;
+      memcpy(a.data.data(), m, sizeof(a.data));
+      memcpy(b.data.data(), n, sizeof(b.data));
+      mat4f product = a * b;
+      m4f_mul_m4fo_scalar(a, b, expected);
+      mat4f_error = std::max(mat4f_error, max_error(expected, product, 16));
+
+      vec4f v(n[0], n[1], n[2], n[3]);
+      vec4f transformed = a * v;
+      m4f_mul_v4fo_scalar(a, v.data(), expected);
+      vec4f_error = std::max(vec4f_error, max_error(expected, transformed.data(), 4));
+    }
+
+    std::vector<ViewInputs> inputs = random_view_inputs(count, 9);
+    float view_error = 0;
+    float stored_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      mat4f expected = view_matrix_scalar(inputs[i]);
+      mat4f actual = view_matrix(inputs[i]);
+      view_error = std::max(view_error, max_error(expected, actual, 16));
+      mat4f stored = view_matrix_stored(inputs[i]);
+      stored_error = std::max(stored_error, max_error(expected, stored, 16));
+    }
+
+    float quaternion_error = 0;
+    for (size_t i = 0; i + 1 < count; ++i) {
+      quaternion expected = quaternion_product_fused(inputs[i].orient, inputs[i + 1].orient);
+      quaternion actual = inputs[i].orient * inputs[i + 1].orient;
+      quaternion_error = std::max(quaternion_error, std::max(fabsf(expected.s - actual.s),
+        max_error(expected.v.data(), actual.v.data(), 3)));
+    }
+
+    fprintf(stderr, "vector_math isa: %s\n", vector_math_isa());
+    bool ok = report_check("m4f_mul_m4fo", m4f_error);
+    ok = report_check("m4f_mul_v4fo", v4f_error) && ok;
+    ok = report_check("m3f_mul_m3fo", m3f_error) && ok;
+    ok = report_check("mat4f * mat4f", mat4f_error) && ok;
+    ok = report_check("mat4f * vec4f", vec4f_error) && ok;
+    ok = report_check("view matrix chain", view_error) && ok;
+    ok = report_check("view matrix chain (stored)", stored_error) && ok;
+    ok = report_check("quaternion product", quaternion_error) && ok;
+    return ok;
+  }
+
+  // an affine transform with non-uniform scale, as would be baked into a
+  // mesh
+  mat4f bake_transform() {
+    return mat4f::trans({0.5f, -2.f, 3.f})
+      * mat4f::rotx(0.7f) * mat4f::rotz(-0.4f)
+      * mat4f::scale({2.f, 0.5f, 1.5f});
+  }
+
+  // Bulk transforms against transforming one vec3f at a time.
+  bool check_mesh_transform() {
+    Mesh mesh = sphere::generate(1.5f, 13);
+    mesh.calculate_normals();
+    size_t count = mesh.vertexes.size();
+    mat4f m = bake_transform();
+    mat3f nm = normal_matrix(m);
+    quaternion q = quaternion::rotation(1.1f, normalized(vec3f(1, 2, -0.5f)));
+    vec3f t(0.25f, 4.f, -1.f);
+
+    Mesh out;
+    transform_mesh(m, mesh, &out, NULL);
+    Mesh in_place = mesh;
+    transform_mesh(m, &in_place, NULL);
+    Mesh rotated;
+    transform_mesh(q, t, mesh, &rotated, NULL);
+
+    float point_error = 0, normal_error = 0, rotation_error = 0, in_place_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      vec4f p = m * vec4f(mesh.vertexes[i], 1);
+      point_error = std::max(point_error, max_error(p.data(), out.vertexes[i].data(), 3));
+
+      vec3f n;
+      m3f_mul_v3fo(nm, mesh.vertex_normals[i].data(), n.data());
+      n = normalized(n);
+      normal_error = std::max(normal_error,
+        max_error(n.data(), out.vertex_normals[i].data(), 3));
+
+      vec3f r = qrotate(mesh.vertexes[i], q) + t;
+      rotation_error = std::max(rotation_error,
+        max_error(r.data(), rotated.vertexes[i].data(), 3));
+
+      in_place_error = std::max(in_place_error,
+        max_error(out.vertexes[i].data(), in_place.vertexes[i].data(), 3));
+    }
+
+    // the transformed normals should be those of the transformed mesh
+    Mesh recalculated = out;
+    recalculated.calculate_normals();
+    float face_error = 0;
+    for (size_t i = 0; i < out.face_normals.size(); ++i) {
+      face_error = std::max(face_error, max_error(recalculated.face_normals[i].data(),
+        out.face_normals[i].data(), 3));
+    }
+
+    bool ok = report_check("transform_points", point_error);
+    ok = report_check("transform_normals", normal_error) && ok;
+    ok = report_check("transform_points quaternion", rotation_error) && ok;
+    ok = report_check("transform_mesh in place", in_place_error) && ok;
+    ok = report_check("transformed face normals", face_error) && ok;
+    return ok;
+  }
+
+  // The face normals of Mesh::calculate_normals, written once for every
+  // width of vec3fx.
+  template <size_t N>
+  void face_normals_x(const Mesh& mesh, vec3f* out) {
+    size_t face_count = mesh.indexes.size() / 3;
+    const vec3f* vertexes = &mesh.vertexes[0];
+    size_t f = 0;
+    for (; f + N <= face_count; f += N) {
+      unsigned corners[3][N];
+      for (size_t k = 0; k < N; ++k) {
+        for (size_t c = 0; c < 3; ++c) {
+          corners[c][k] = mesh.indexes[3*(f + k) + c];
+        }
+      }
+      simd::vec3fx<N> a = simd::gather<N>(vertexes, corners[0]);
+      simd::vec3fx<N> b = simd::gather<N>(vertexes, corners[1]);
+      simd::vec3fx<N> c = simd::gather<N>(vertexes, corners[2]);
+      simd::store(out + f, -normalized(cross(b - a, c - a)));
+    }
+    for (; f < face_count; ++f) {
+      const vec3f& a = vertexes[mesh.indexes[3*f]];
+      const vec3f& b = vertexes[mesh.indexes[3*f + 1]];
+      const vec3f& c = vertexes[mesh.indexes[3*f + 2]];
+      out[f] = -normalized(cross(b - a, c - a));
+    }
+  }
+
+  void face_normals(const Mesh& mesh, vec3f* out) {
+    face_normals_x<1>(mesh, out);
+  }
+
+  template <size_t N>
+  float face_normals_error(const Mesh& mesh) {
+    std::vector<vec3f> normals(mesh.face_normals.size());
+    face_normals_x<N>(mesh, &normals[0]);
+    float error = 0;
+    for (size_t i = 0; i < normals.size(); ++i) {
+      error = std::max(error, max_error(mesh.face_normals[i].data(), normals[i].data(), 3));
+    }
+    return error;
+  }
+
+  // vec3fx against vec3f, lane by lane.
+  bool check_vec3f_x() {
+    Mesh mesh = sphere::generate(1.f, 13);
+    mesh.calculate_normals();
+    bool ok = report_check("face normals vec3f_x4", face_normals_error<4>(mesh));
+    ok = report_check("face normals vec3f_x8", face_normals_error<8>(mesh)) && ok;
+    ok = report_check("face normals vec3f_x16", face_normals_error<16>(mesh)) && ok;
+    ok = report_check("face normals vec3fx<3>", face_normals_error<3>(mesh)) && ok;
+
+    // select the longer of two vectors and scatter it to the reversed
+    // positions
+    const size_t n = 8;
+    std::vector<float> values = random_floats(6 * n, 11);
+    std::vector<vec3f> a(n), b(n), scattered(n);
+    unsigned reversed[n];
+    for (size_t i = 0; i < n; ++i) {
+      a[i] = vec3f(values[6*i], values[6*i + 1], values[6*i + 2]);
+      b[i] = vec3f(values[6*i + 3], values[6*i + 4], values[6*i + 5]);
+      reversed[i] = (unsigned)(n - 1 - i);
+    }
+    simd::vec3f_x8 va = simd::load<8>(&a[0]);
+    simd::vec3f_x8 vb = simd::load<8>(&b[0]);
+    simd::scatter(&scattered[0], reversed, select(magnitude(va) > magnitude(vb), va, vb));
+    float select_error = 0;
+    for (size_t i = 0; i < n; ++i) {
+      vec3f expected = magnitude(a[i]) > magnitude(b[i]) ? a[i] : b[i];
+      select_error = std::max(select_error,
+        max_error(expected.data(), scattered[n - 1 - i].data(), 3));
+    }
+    ok = report_check("vec3f_x8 select and scatter", select_error) && ok;
+    return ok;
+  }
+
+  // The math types in constant expressions, against the same expressions
+  // worked at run time.
+  constexpr sphere::Table<13> k_sphere = sphere::table<13>(1.5f);
+  constexpr quaternion k_orient = quaternion::rotation(0.6f, vec3f(0.f, 0.6f, 0.8f));
+  constexpr mat4f k_view = mat4f::ortho() * mat4f::scale({1.5f, 1.5f, 1.5f})
+    * mat4f::trans({0.25f, -0.5f, 0.f}) * k_orient.to_mat4f() * mat4f::rotx(0.3f);
+  static_assert(mat4f::identity().at(3, 3) == 1.f && mat4f::ortho().at(2, 2) == 0.f,
+                "constexpr mat4f");
+  static_assert(kernel::poly6_norm > 0.f, "constexpr kernel norms");
+
+  bool check_constexpr() {
+    Mesh mesh = sphere::generate(1.5f, 13);
+    float sphere_error = 0;
+    for (size_t i = 0; i < mesh.vertexes.size(); ++i) {
+      sphere_error = std::max(sphere_error,
+        max_error(mesh.vertexes[i].data(), k_sphere.vertexes[i].data(), 3));
+    }
+    bool same_indexes = mesh.indexes.size() == sphere::index_count(13)
+      && memcmp(mesh.indexes.data(), k_sphere.indexes, sizeof(k_sphere.indexes)) == 0;
+
+    // volatile keeps the compiler from folding these too
+    volatile float angle = 0.6f, rx = 0.3f;
+    quaternion orient = quaternion::rotation(angle, vec3f(0.f, 0.6f, 0.8f));
+    mat4f view = mat4f::ortho() * mat4f::scale({1.5f, 1.5f, 1.5f})
+      * mat4f::trans({0.25f, -0.5f, 0.f}) * orient.to_mat4f() * mat4f::rotx(rx);
+    volatile float length_sq = 2.f;
+    constexpr float root = vector_math_sqrtf(2.f);
+
+    bool ok = report_check("constexpr sphere::table", same_indexes ? sphere_error : 1.f);
+    ok = report_check("constexpr view matrix", max_error(view, k_view, 16)) && ok;
+    ok = report_check("constexpr sqrt", fabsf(root - sqrtf(length_sq))) && ok;
+    return ok;
+  }
+
+  // The vec<T, N> widths that have SIMD arithmetic, worked out by the
+  // compiler and then at run time through the registers; + - * / round
+  // the same in both, so they must agree to the bit. No product feeds a
+  // sum, which -ffp-contract could fuse at run time only.
+  template <typename T, size_t N>
+  constexpr vec<T, N> vec_expression(vec<T, N> a, vec<T, N> b, T s) {
+    vec<T, N> r = (a + b) * s;
+    r = r / s - b;
+    r += -a;
+    r *= s;
+    return r * (a - b);
+  }
+
+  template <typename T, size_t N>
+  constexpr vec<T, N> vec_sequence(T first) {
+    vec<T, N> v = vec<T, N>();
+    for (size_t i = 0; i < N; ++i) {
+      v[i] = first + T(i) / T(4);
+    }
+    return v;
+  }
+
+  static_assert(std::is_same<vec3f, vec<float, 3>>::value, "vec3f alias");
+  static_assert(sizeof(vec2f) == 8 && sizeof(vec3f) == 12 && alignof(vec3f) == 4,
+                "vec2f and vec3f pack as before");
+  static_assert(alignof(vec4f) == 16 && alignof(vec2d) == 16 && alignof(vec4d) == 32,
+                "vec SIMD alignment");
+
+  template <typename T, size_t N>
+  bool check_vec_width(const char* name) {
+    constexpr vec<T, N> expected =
+      vec_expression(vec_sequence<T, N>(T(0.3)), vec_sequence<T, N>(T(-1.7)), T(1.25));
+    volatile T first_a = T(0.3), first_b = T(-1.7), s = T(1.25);
+    vec<T, N> actual =
+      vec_expression(vec_sequence<T, N>(first_a), vec_sequence<T, N>(first_b), T(s));
+    bool same = memcmp(expected.data(), actual.data(), sizeof(T) * N) == 0;
+    return report_check(name, same ? 0.f : 1.f);
+  }
+
+  bool check_vec() {
+    bool ok = check_vec_width<float, 4>("vec4f registers against constexpr");
+    ok = check_vec_width<double, 2>("vec2d registers against constexpr") && ok;
+    ok = check_vec_width<double, 4>("vec4d registers against constexpr") && ok;
+    ok = check_vec_width<double, 3>("vec3d against constexpr") && ok;
+
+    // a drag a millionth of the view wide, many times over, at the far end
+    // of a pan; in float every step would round away
+    volatile float step = 1e-6f;
+    vec2d pan(1000.0, 1000.0);
+    for (int i = 0; i < 1000; ++i) {
+      pan += vec2d(vec2f(step, step));
+    }
+    double drift = fabs(pan.x() - (1000.0 + 1000 * (double)1e-6f));
+    ok = report_check_within("vec2d pan accumulation", (float)drift, 1e-9f) && ok;
+    return ok;
+  }
+
+  // The _fast functions of vector_math.h against their documented errors.
+  bool check_fast_math() {
+    // every float in [1, 4) covers each mantissa with both exponent parities
+    float rsqrt_error = 0;
+    for (float x = 1.f; x < 4.f; x = nextafterf(x, 4.f)) {
+      double expected = 1. / sqrt((double)x);
+      rsqrt_error = std::max(rsqrt_error,
+        (float)(fabs(rsqrtf_fast(x) - expected) / expected));
+    }
+
+    float acos_error = 0;
+    const size_t acos_steps = 1 << 20;
+    for (size_t i = 0; i <= acos_steps; ++i) {
+      float x = -1.f + 2.f * i / acos_steps;
+      acos_error = std::max(acos_error, (float)fabs(acosf_fast(x) - acos((double)x)));
+    }
+
+    const size_t count = 65536;
+    std::vector<float> values = random_floats(3 * count, 15);
+    float normalized_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      vec3f v(values[3*i], values[3*i + 1], values[3*i + 2]);
+      vec3f n = normalized_fast(v);
+      double length = sqrt((double)n[0]*n[0] + (double)n[1]*n[1] + (double)n[2]*n[2]);
+      normalized_error = std::max(normalized_error, (float)fabs(length - 1.));
+    }
+
+    // also spheres small and large enough that a product of two squared
+    // edge lengths would leave the range of a float
+    const float radii[] = { 1.5f, 1e-9f, 1e12f };
+    float normals_error = 0;
+    for (float radius : radii) {
+      Mesh precise = sphere::generate(radius, 13);
+      Mesh fast = precise;
+      precise.calculate_weighted_normals(MATH_PRECISE);
+      fast.calculate_weighted_normals(MATH_FAST);
+      for (size_t i = 0; i < precise.vertex_normals.size(); ++i) {
+        normals_error = std::max(normals_error, max_error(precise.vertex_normals[i].data(),
+          fast.vertex_normals[i].data(), 3));
+      }
+    }
+
+    bool ok = report_check_within("rsqrtf_fast", rsqrt_error, 4e-7f);
+    ok = report_check_within("acosf_fast", acos_error, 6.8e-5f) && ok;
+    ok = report_check_within("normalized_fast", normalized_error, 6e-7f) && ok;
+    ok = report_check_within("weighted normals MATH_FAST", normals_error, 1e-4f) && ok;
+    return ok;
+  }
+
+  // Sources and a grid for the field kernels, with the grid a few samples
+  // wider than a multiple of every lane count.
+  struct FieldCase {
+    std::vector<float> sources;
+    std::vector<float> field;
+    FieldBlock block;
+  };
+
+  void init_field_case(size_t width, size_t height, size_t source_count,
+                       FieldCase* out) {
+    out->sources = random_floats(2 * source_count, 12);
+    for (size_t i = 0; i < out->sources.size(); ++i) {
+      out->sources[i] *= 4.f;
+    }
+    out->field.assign(width * height, 0.f);
+    FieldBlock& block = out->block;
+    block.sources = out->sources.data();
+    block.source_count = source_count;
+    block.support_sq = 16.f;
+    block.origin[0] = -4.f;
+    block.origin[1] = -4.f;
+    block.x_step[0] = 8.f / width;
+    block.x_step[1] = 0.f;
+    block.y_step[0] = 0.f;
+    block.y_step[1] = 8.f / height;
+    block.width = width;
+    block.x_begin = 0;
+    block.x_end = width;
+    block.y_begin = 0;
+    block.y_end = height;
+    block.field = out->field.data();
+  }
+
+  bool check_cpu_kernel(const CpuKernels& kernels, const char* kernel, float error) {
+    char name[64];
+    snprintf(name, sizeof(name), "%s %s", kernels.name, kernel);
+    return report_check(name, error);
+  }
+
+  float max_error(const quaternion& expected, const quaternion& actual) {
+    return max_error(floats(&expected), floats(&actual), 4);
+  }
+
+  // The quaternion kernels of one table against the operations of
+  // quaternion.h, over a count that leaves a tail at every width.
+  bool check_quaternion_kernels(const CpuKernels& kernels) {
+    const size_t count = 1031;
+    std::vector<quaternion> from, to;
+    random_keyframes(count, 15, &from, &to);
+    std::vector<mat4f> matrices(count);
+    std::vector<quaternion> out(count);
+    const float t = 0.3f;
+
+    kernels.quaternions_to_mat4f(floats(&from[0]), count, matrices[0]);
+    float to_mat4f_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      to_mat4f_error = std::max(to_mat4f_error,
+        max_error(from[i].to_mat4f(), matrices[i], 16));
+    }
+    bool ok = check_cpu_kernel(kernels, "quaternions_to_mat4f", to_mat4f_error);
+
+    kernels.compose_quaternions(floats(&from[0]), floats(&to[0]), count, floats(&out[0]));
+    float compose_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      compose_error = std::max(compose_error, max_error(from[i] * to[i], out[i]));
+    }
+    ok = check_cpu_kernel(kernels, "compose_quaternions", compose_error) && ok;
+
+    kernels.nlerp_quaternions(floats(&from[0]), floats(&to[0]), t, count, floats(&out[0]));
+    float nlerp_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      nlerp_error = std::max(nlerp_error, max_error(nlerp(from[i], to[i], t), out[i]));
+    }
+    ok = check_cpu_kernel(kernels, "nlerp_quaternions", nlerp_error) && ok;
+
+    kernels.slerp_quaternions(floats(&from[0]), floats(&to[0]), t, count, floats(&out[0]));
+    float slerp_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      slerp_error = std::max(slerp_error, max_error(slerp(from[i], to[i], t), out[i]));
+    }
+    ok = check_cpu_kernel(kernels, "slerp_quaternions", slerp_error) && ok;
+
+    // drifted off unit length, and one zero
+    std::vector<quaternion> drifted(count);
+    for (size_t i = 0; i < count; ++i) {
+      drifted[i] = (1.f + 0.01f * (i % 7)) * from[i];
+    }
+    drifted[count / 2] = quaternion(0, vec3f(0, 0, 0));
+    kernels.normalize_quaternions(floats(&drifted[0]), count, floats(&out[0]));
+    float normalize_error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      normalize_error = std::max(normalize_error, max_error(normalized(drifted[i]), out[i]));
+    }
+    ok = check_cpu_kernel(kernels, "normalize_quaternions", normalize_error) && ok;
+    return ok;
+  }
+
+  // Every cpu_kernels() table that this CPU runs against the scalar one.
+  bool check_cpu_kernels() {
+    const CpuKernels& scalar = cpu_kernel_table(cpu_kernel_table_count() - 1);
+    const size_t count = 1031;
+    std::vector<float> lhs = random_floats(16 * count, 13);
+    std::vector<float> rhs = random_floats(16 * count, 14);
+    Mesh mesh = sphere::generate(1.5f, 13);
+    const float* vertexes = mesh.vertexes[0].data();
+    size_t vertex_count = mesh.vertexes.size();
+    size_t face_count = mesh.indexes.size() / 3;
+    float affine[12];
+    memcpy(affine, bake_transform().data.data(), sizeof(affine));
+
+    size_t output_count = 3 * std::max(vertex_count, face_count);
+    std::vector<float> expected(output_count), actual(output_count);
+    FieldCase expected_field, actual_field;
+    init_field_case(77, 21, 40, &expected_field);
+    init_field_case(77, 21, 40, &actual_field);
+
+    fprintf(stderr, "cpu kernels: %s\n", cpu_kernels().name);
+    bool ok = true;
+    for (size_t t = 0; t < cpu_kernel_table_count(); ++t) {
+      const CpuKernels& kernels = cpu_kernel_table(t);
+      if (!cpu_supports(kernels.isa)) {
+        fprintf(stderr, "skipping %s kernels, which this CPU does not support\n", kernels.name);
+        continue;
+      }
+
+      float m4f_error = 0, v4f_error = 0, m3f_error = 0;
+      for (size_t i = 0; i < count; ++i) {
+        const float* m = &lhs[16*i];
+        const float* n = &rhs[16*i];
+        float e[16], a[16];
+        scalar.m4f_mul_m4fo(m, n, e);
+        kernels.m4f_mul_m4fo(m, n, a);
+        m4f_error = std::max(m4f_error, max_error(e, a, 16));
+        scalar.m4f_mul_v4fo(m, n, e);
+        kernels.m4f_mul_v4fo(m, n, a);
+        v4f_error = std::max(v4f_error, max_error(e, a, 4));
+        scalar.m3f_mul_m3fo(m, n, e);
+        kernels.m3f_mul_m3fo(m, n, a);
+        m3f_error = std::max(m3f_error, max_error(e, a, 9));
+      }
+      ok = check_cpu_kernel(kernels, "m4f_mul_m4fo", m4f_error) && ok;
+      ok = check_cpu_kernel(kernels, "m4f_mul_v4fo", v4f_error) && ok;
+      ok = check_cpu_kernel(kernels, "m3f_mul_m3fo", m3f_error) && ok;
+
+      scalar.transform_points(affine, vertexes, vertex_count, &expected[0]);
+      kernels.transform_points(affine, vertexes, vertex_count, &actual[0]);
+      ok = check_cpu_kernel(kernels, "transform_points",
+        max_error(&expected[0], &actual[0], 3 * vertex_count)) && ok;
+
+      scalar.transform_normals(affine, vertexes, vertex_count, &expected[0]);
+      kernels.transform_normals(affine, vertexes, vertex_count, &actual[0]);
+      ok = check_cpu_kernel(kernels, "transform_normals",
+        max_error(&expected[0], &actual[0], 3 * vertex_count)) && ok;
+
+      scalar.face_normals(vertexes, &mesh.indexes[0], face_count, &expected[0]);
+      kernels.face_normals(vertexes, &mesh.indexes[0], face_count, &actual[0]);
+      ok = check_cpu_kernel(kernels, "face_normals",
+        max_error(&expected[0], &actual[0], 3 * face_count)) && ok;
+
+      // every prefix length, to cover the tails
+      float box_error = 0;
+      for (size_t n = 1; n <= 40; ++n) {
+        float e[6], a[6];
+        scalar.bounding_box(vertexes, n, e, e + 3);
+        kernels.bounding_box(vertexes, n, a, a + 3);
+        box_error = std::max(box_error, max_error(e, a, 6));
+      }
+      ok = check_cpu_kernel(kernels, "bounding_box", box_error) && ok;
+
+      float field_error = 0;
+      for (int type = 0; type < KERNEL_TYPE_COUNT; ++type) {
+        scalar.field_block[type](expected_field.block);
+        kernels.field_block[type](actual_field.block);
+        field_error = std::max(field_error, max_error(&expected_field.field[0],
+          &actual_field.field[0], expected_field.field.size()));
+      }
+      ok = check_cpu_kernel(kernels, "field_block", field_error) && ok;
+      ok = check_quaternion_kernels(kernels) && ok;
+    }
+    return ok;
+  }
+
+  // Every world matrix of graph against multiplying out the local ones from
+  // its root, which ids from add_node() order parents first.
+  float scene_graph_error(const SceneGraph& graph) {
+    std::vector<mat4f> expected(graph.node_count());
+    float error = 0;
+    for (size_t id = 0; id < graph.node_count(); ++id) {
+      size_t parent = graph.parent(id);
+      expected[id] = graph.local(id).to_mat4f();
+      if (parent != SceneGraph::k_no_parent) {
+        expected[id] = expected[parent] * expected[id];
+      }
+      error = std::max(error, max_error(expected[id], graph.world(id), 16));
+    }
+    return error;
+  }
+
+  // Updates from scratch, after moving a few nodes and after adding more,
+  // each recomputing exactly the moved nodes and what lies below them.
+  bool check_scene_graph(ThreadPool* pool) {
+    Random random = { 18 };
+    SceneGraph graph;
+    add_random_nodes(&graph, 20000, 4, &random);
+    size_t recomputed = graph.update(pool);
+    bool ok = report_check("scene graph", scene_graph_error(graph));
+    ok = report_check("scene graph recomputed", (float)(recomputed - graph.node_count())) && ok;
+
+    // ids a few levels down, with the subtrees under them
+    std::vector<size_t> moved;
+    std::vector<bool> below(graph.node_count(), false);
+    for (size_t k = 0; k < 8; ++k) {
+      moved.push_back(graph.node_count() / 8 * k + 37);
+    }
+    for (size_t k = 0; k < moved.size(); ++k) {
+      graph.set_local(moved[k], random_local(&random));
+      below[moved[k]] = true;
+    }
+    size_t expected = 0;
+    for (size_t id = 0; id < graph.node_count(); ++id) {
+      size_t parent = graph.parent(id);
+      below[id] = below[id] || (parent != SceneGraph::k_no_parent && below[parent]);
+      expected += below[id];
+    }
+    recomputed = graph.update(pool);
+    ok = report_check("scene graph moved", scene_graph_error(graph)) && ok;
+    ok = report_check("scene graph moved recomputed", fabsf((float)recomputed - expected)) && ok;
+    ok = report_check("scene graph unchanged recomputed", (float)graph.update(pool)) && ok;
+
+    add_random_nodes(&graph, 500, 0, &random);
+    graph.set_local(3, random_local(&random));
+    graph.update(pool);
+    ok = report_check("scene graph added", scene_graph_error(graph)) && ok;
+    return ok;
+  }
+
+  // The quaternion_batch.h wrappers in place, over enough chunks to split
+  // across the pool.
+  bool check_quaternion_batch(ThreadPool* pool) {
+    const size_t count = 40000;
+    std::vector<quaternion> from, to;
+    random_keyframes(count, 16, &from, &to);
+    std::vector<quaternion> out = from;
+    slerp_quaternions(&out[0], &to[0], 0.6f, count, &out[0], pool);
+    compose_quaternions(&out[0], &to[0], count, &out[0], pool);
+    float error = 0;
+    for (size_t i = 0; i < count; ++i) {
+      error = std::max(error, max_error(slerp(from[i], to[i], 0.6f) * to[i], out[i]));
+    }
+    return report_check("quaternion batch (pool)", error);
+  }
+
+  // The field of every source at every sample of grid, summed directly with
+  // the kernels of misc/kernels.h.
+  std::vector<float> reference_field(KernelType type, const std::vector<float>& sources,
+                                     const FieldGrid& grid) {
+    std::vector<float> field(grid.width * grid.height);
+    for (size_t y = 0; y < grid.height; ++y) {
+      for (size_t x = 0; x < grid.width; ++x) {
+        float px = grid.origin[0] + grid.y_step[0] * y + grid.x_step[0] * x;
+        float py = grid.origin[1] + grid.y_step[1] * y + grid.x_step[1] * x;
+        float sum = 0;
+        for (size_t i = 0; i < sources.size(); i += 2) {
+          float dx = px - sources[i];
+          float dy = py - sources[i + 1];
+          sum += k_kernels[type].value(dx*dx + dy*dy);
+        }
+        field[y * grid.width + x] = sum;
+      }
+    }
+    return field;
+  }
+
+  // evaluate_field against reference_field for every kernel, on and off the
+  // pool, over grids that end part way through a tile, one of them turned
+  // and flipped. Some sources sit on tile corners and some beyond the grid,
+  // which only their support reaches.
+  bool check_field_eval(ThreadPool* pool) {
+    std::vector<float> sources = random_floats(2 * 24, 19);
+    for (size_t i = 0; i < sources.size(); ++i) {
+      sources[i] *= 9.f;
+    }
+    const float edges[] = {
+      0.75f, -1.125f,   // the corner of tiles (1, 1), 64 and 16 samples in
+      0.8f, 0.3f,       // just inside tile column 1
+      14.5f, 0.f,       // beyond the right edge, in reach of the Gaussian
+      -3.f, -6.f,       // below the bottom edge
+    };
+    sources.insert(sources.end(), edges, edges + sizeof(edges) / sizeof(edges[0]));
+
+    // Steps of a few 64ths put every sample exactly where reference_field
+    // puts it. Otherwise an FMA in one and not the other moves samples by an
+    // ulp, which the viscosity kernel magnifies a hundredfold near its clamp.
+    FieldGrid grids[2] = {
+      { { -7.25f, -3.125f }, { 0.125f, 0.f }, { 0.f, 0.125f }, 150, 70 },
+      { { -6.f, 5.f }, { 0.0625f, -0.046875f }, { 0.046875f, -0.09375f }, 131, 83 },
+    };
+    const char* names[2] = { "evaluate_field", "evaluate_field turned" };
+    bool ok = true;
+    for (size_t g = 0; g < 2; ++g) {
+      const FieldGrid& grid = grids[g];
+      float error = 0;
+      for (size_t type = 0; type < KERNEL_TYPE_COUNT; ++type) {
+        std::vector<float> expected = reference_field(KernelType(type), sources, grid);
+        std::vector<float> actual(expected.size(), -1.f);
+        evaluate_field(KernelType(type), &sources[0], sources.size() / 2, grid,
+          &actual[0], g == 0 ? NULL : pool);
+        error = std::max(error, max_error(&expected[0], &actual[0], expected.size()));
+      }
+      ok = report_check(names[g], error) && ok;
+    }
+
+    // The Gaussian stops at kernel::gaussian_cutoff_sq. Samples run along
+    // a line through a single source, none of them near the cut-off itself.
+    const float source[2] = { 0.f, 0.f };
+    FieldGrid line = { { 0.05f, 0.f }, { 0.1f, 0.f }, { 0.f, 0.1f }, 100, 1 };
+    std::vector<float> field(line.width);
+    evaluate_field(KERNEL_GAUSSIAN, source, 1, line, &field[0], pool);
+    size_t wrong = 0;
+    for (size_t x = 0; x < line.width; ++x) {
+      float distance = line.origin[0] + line.x_step[0] * x;
+      bool inside = distance * distance <= kernel::gaussian_cutoff_sq;
+      wrong += inside != (field[x] > 0.f);
+    }
+    ok = report_check("evaluate_field gaussian cut-off", (float)wrong) && ok;
+    return ok;
+  }
+
+  // colormap_field_rgba8 against the texels of pack_colormaps_rgba8, which
+  // are what the shaders sample: values at a texel centre or beyond either
+  // end give that texel, and values halfway between two centres give their
+  // mean, to within the rounding of the last bit.
+  bool check_colormap_field(ThreadPool* pool) {
+    const size_t width = k_colormap_width;
+    std::vector<unsigned char> texels(4 * width * COLORMAP_COUNT);
+    pack_colormaps_rgba8(&texels[0]);
+
+    const float range_min = -2.f, range_max = 3.f;
+    std::vector<float> field;
+    for (size_t j = 0; j < width; ++j) {
+      field.push_back(range_min + (range_max - range_min) * (j + 0.5f) / width);
+    }
+    for (size_t j = 0; j + 1 < width; ++j) {
+      field.push_back(range_min + (range_max - range_min) * (j + 1.f) / width);
+    }
+    const float ends[] = { -100.f, range_min, range_max, 100.f };
+    const size_t end_texels[] = { 0, 0, width - 1, width - 1 };
+    field.insert(field.end(), ends, ends + 4);
+
+    float centre_error = 0, between_error = 0;
+    std::vector<unsigned char> out(4 * field.size());
+    for (size_t id = 0; id < COLORMAP_COUNT; ++id) {
+      const unsigned char* map = &texels[4 * width * id];
+      colormap_field_rgba8(ColormapId(id), &field[0], field.size(), range_min, range_max,
+        &out[0], id % 2 ? pool : NULL);
+      for (size_t i = 0; i < field.size(); ++i) {
+        for (size_t c = 0; c < 4; ++c) {
+          float actual = out[4*i + c];
+          if (i < width) {
+            centre_error = std::max(centre_error, fabsf(actual - map[4*i + c]));
+          } else if (i < 2*width - 1) {
+            const unsigned char* a = map + 4 * (i - width);
+            float mean = 0.5f * (a[c] + a[4 + c]);
+            between_error = std::max(between_error, fabsf(actual - mean));
+          } else {
+            size_t j = end_texels[i - (2*width - 1)];
+            centre_error = std::max(centre_error, fabsf(actual - map[4*j + c]));
+          }
+        }
+      }
+    }
+    bool ok = report_check("colormap_field_rgba8 texels", centre_error);
+    ok = report_check_within("colormap_field_rgba8 between", between_error, 0.5f) && ok;
+    return ok;
+  }
+
+  typedef void (*MatrixKernel)(const float*, const float*, float*);
+
+  // Times kernel over count independent (m, n) pairs, where m holds
+  // lhs_size floats, n rhs_size and the result result_size.
+  void bench_matrix_kernel(BenchRunner* runner, const char* name, MatrixKernel kernel,
+      size_t lhs_size, size_t rhs_size, size_t result_size) {
+    const size_t sizes[] = { 1, 256, 65536 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      size_t count = sizes[s];
+      std::vector<float> lhs = random_floats(lhs_size * count, 1);
+      std::vector<float> rhs = random_floats(rhs_size * count, 2);
+      std::vector<float> result(result_size * count);
+      BenchCase bench = { name, count, (double)count,
+        (double)(lhs_size + rhs_size + result_size) * sizeof(float) * count };
+      runner->run(bench, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          kernel(&lhs[lhs_size*i], &rhs[rhs_size*i], &result[result_size*i]);
+        }
+        do_not_optimize(result[0]);
+      });
+    }
+  }
+
+  void bench_m4f_mul_m4fo(BenchRunner* runner) {
+    bench_matrix_kernel(runner, "m4f_mul_m4fo", m4f_mul_m4fo, 16, 16, 16);
+    bench_matrix_kernel(runner, "m4f_mul_m4fo_scalar", m4f_mul_m4fo_scalar, 16, 16, 16);
+    bench_matrix_kernel(runner, "m4f_mul_v4fo", m4f_mul_v4fo, 16, 4, 4);
+    bench_matrix_kernel(runner, "m4f_mul_v4fo_scalar", m4f_mul_v4fo_scalar, 16, 4, 4);
+    bench_matrix_kernel(runner, "m3f_mul_m3fo", m3f_mul_m3fo, 9, 9, 9);
+    bench_matrix_kernel(runner, "m3f_mul_m3fo_scalar", m3f_mul_m3fo_scalar, 9, 9, 9);
+  }
+
+  // The projection and view products that display() makes every frame.
+  void bench_view_matrix(BenchRunner* runner) {
+    const size_t count = 1024;
+    std::vector<ViewInputs> inputs = random_view_inputs(count, 10);
+    std::vector<mat4f> result(count);
+    BenchCase bench = { "view matrix chain", count, (double)count,
+      (double)(sizeof(ViewInputs) + sizeof(mat4f)) * count };
+    runner->run(bench, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] = view_matrix(inputs[i]);
+      }
+      do_not_optimize(result[0]);
+    });
+    BenchCase scalar = { "view matrix chain (scalar)", count, (double)count,
+      (double)(sizeof(ViewInputs) + sizeof(mat4f)) * count };
+    runner->run(scalar, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] = view_matrix_scalar(inputs[i]);
+      }
+      do_not_optimize(result[0]);
+    });
+    BenchCase stored = { "view matrix chain (stored)", count, (double)count,
+      (double)(sizeof(ViewInputs) + sizeof(mat4f)) * count };
+    runner->run(stored, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] = view_matrix_stored(inputs[i]);
+      }
+      do_not_optimize(result[0]);
+    });
+  }
+
+  // The vec3f operators against the same expressions written out by hand.
+  void bench_vec3f_expressions(BenchRunner* runner) {
+    const size_t count = 1024;
+    std::vector<ViewInputs> inputs = random_view_inputs(count + 1, 13);
+    std::vector<quaternion> products(count);
+    BenchCase product = { "quaternion product", count, (double)count,
+      (double)(3 * sizeof(quaternion)) * count };
+    runner->run(product, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        products[i] = inputs[i].orient * inputs[i + 1].orient;
+      }
+      do_not_optimize(products[0]);
+    });
+    BenchCase product_fused = { "quaternion product (fused)", count, (double)count,
+      (double)(3 * sizeof(quaternion)) * count };
+    runner->run(product_fused, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        products[i] = quaternion_product_fused(inputs[i].orient, inputs[i + 1].orient);
+      }
+      do_not_optimize(products[0]);
+    });
+
+    std::vector<float> values = random_floats(6 * count, 14);
+    std::vector<Box> boxes(count);
+    for (size_t i = 0; i < count; ++i) {
+      const float* v = &values[6*i];
+      boxes[i].min_corner = vec3f(v[0], v[1], v[2]);
+      boxes[i].max_corner = vec3f(v[3], v[4], v[5]);
+    }
+    std::vector<vec3f> centers(count);
+    BenchCase center = { "Box::center", count, (double)count,
+      (double)(sizeof(Box) + sizeof(vec3f)) * count };
+    runner->run(center, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        centers[i] = boxes[i].center();
+      }
+      do_not_optimize(centers[0]);
+    });
+    BenchCase center_fused = { "Box::center (fused)", count, (double)count,
+      (double)(sizeof(Box) + sizeof(vec3f)) * count };
+    runner->run(center_fused, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        centers[i] = box_center_fused(boxes[i]);
+      }
+      do_not_optimize(centers[0]);
+    });
+  }
+
+  void bench_m3f_mul_av3fo(BenchRunner* runner) {
+    const size_t sizes[] = { 1024, 65536, 1048576 };
+    std::vector<float> m = random_floats(9, 3);
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      size_t count = sizes[s];
+      std::vector<float> input = random_floats(3 * count, 4);
+      std::vector<float> result(3 * count);
+      BenchCase bench = { "m3f_mul_av3fo", count, (double)count,
+        2.0 * 3 * sizeof(float) * count };
+      runner->run(bench, [&] {
+        m3f_mul_av3fo(m.data(), input.data(), 3 * count, result.data());
+        do_not_optimize(result[0]);
+      });
+    }
+  }
+
+  void bench_quaternion_to_mat4f(BenchRunner* runner) {
+    const size_t sizes[] = { 1, 1024, 65536 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      size_t count = sizes[s];
+      std::vector<float> values = random_floats(4 * count, 5);
+      std::vector<quaternion> input(count);
+      for (size_t i = 0; i < count; ++i) {
+        input[i] = quaternion(values[4*i],
+          normalized(vec3f(values[4*i + 1], values[4*i + 2], values[4*i + 3])));
+      }
+      std::vector<mat4f> result(count);
+      BenchCase bench = { "quaternion::to_mat4f", count, (double)count,
+        (double)(sizeof(quaternion) + sizeof(mat4f)) * count };
+      runner->run(bench, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          result[i] = input[i].to_mat4f();
+        }
+        do_not_optimize(result[0]);
+      });
+    }
+  }
+
+  // The operations of misc/quaternion_batch.h against calling quaternion.h
+  // once per instance.
+  void bench_quaternion_batch(BenchRunner* runner, ThreadPool* pool) {
+    const size_t sizes[] = { 1024, 65536 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      size_t count = sizes[s];
+      std::vector<quaternion> from, to;
+      random_keyframes(count, 17, &from, &to);
+      std::vector<quaternion> out(count);
+      std::vector<mat4f> matrices(count);
+      double matrix_bytes = (double)(sizeof(quaternion) + sizeof(mat4f)) * count;
+      double pair_bytes = 3.0 * sizeof(quaternion) * count;
+
+      BenchCase to_mat4f = { "quaternions_to_mat4f", count, (double)count, matrix_bytes };
+      runner->run(to_mat4f, [&] {
+        quaternions_to_mat4f(&from[0], count, &matrices[0], NULL);
+        do_not_optimize(matrices[0]);
+      });
+
+      BenchCase to_mat4f_pool = { "quaternions_to_mat4f (pool)", count, (double)count,
+        matrix_bytes };
+      runner->run(to_mat4f_pool, [&] {
+        quaternions_to_mat4f(&from[0], count, &matrices[0], pool);
+        do_not_optimize(matrices[0]);
+      });
+
+      BenchCase product = { "quaternion product per instance", count, (double)count,
+        pair_bytes };
+      runner->run(product, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          out[i] = from[i] * to[i];
+        }
+        do_not_optimize(out[0]);
+      });
+
+      BenchCase compose = { "compose_quaternions", count, (double)count, pair_bytes };
+      runner->run(compose, [&] {
+        compose_quaternions(&from[0], &to[0], count, &out[0], NULL);
+        do_not_optimize(out[0]);
+      });
+
+      BenchCase slerp_each = { "slerp per instance", count, (double)count, pair_bytes };
+      runner->run(slerp_each, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          out[i] = slerp(from[i], to[i], 0.3f);
+        }
+        do_not_optimize(out[0]);
+      });
+
+      BenchCase slerp_batch = { "slerp_quaternions", count, (double)count, pair_bytes };
+      runner->run(slerp_batch, [&] {
+        slerp_quaternions(&from[0], &to[0], 0.3f, count, &out[0], NULL);
+        do_not_optimize(out[0]);
+      });
+
+      BenchCase nlerp_batch = { "nlerp_quaternions", count, (double)count, pair_bytes };
+      runner->run(nlerp_batch, [&] {
+        nlerp_quaternions(&from[0], &to[0], 0.3f, count, &out[0], NULL);
+        do_not_optimize(out[0]);
+      });
+
+      BenchCase normalize_each = { "normalized(quaternion) per instance", count,
+        (double)count, 2.0 * sizeof(quaternion) * count };
+      runner->run(normalize_each, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          out[i] = normalized(from[i]);
+        }
+        do_not_optimize(out[0]);
+      });
+
+      out = from;
+      BenchCase normalize_batch = { "normalize_quaternions", count, (double)count,
+        2.0 * sizeof(quaternion) * count };
+      runner->run(normalize_batch, [&] {
+        normalize_quaternions(&out[0], count, NULL);
+        do_not_optimize(out[0]);
+      });
+    }
+  }
+
+  // 100k nodes under 16 roots, moving every root, a few nodes in the
+  // middle, or nothing.
+  void bench_scene_graph(BenchRunner* runner, ThreadPool* pool) {
+    const size_t count = 100000;
+    const size_t root_count = 16;
+    Random random = { 19 };
+    SceneGraph graph;
+    add_random_nodes(&graph, count, root_count, &random);
+    graph.update(NULL);
+    std::vector<LocalTransform> locals(count);
+    for (size_t id = 0; id < count; ++id) {
+      locals[id] = graph.local(id);
+    }
+
+    // the roots, or nodes spread through the ids past them
+    std::vector<size_t> roots, spread;
+    for (size_t k = 0; k < root_count; ++k) {
+      roots.push_back(k);
+      spread.push_back(root_count + count / root_count * k);
+    }
+    std::vector<size_t> none;
+
+    struct Case {
+      const char* name;
+      const std::vector<size_t>* moved;
+      ThreadPool* pool;
+    };
+    const Case cases[] = {
+      { "SceneGraph::update, roots moved", &roots, NULL },
+      { "SceneGraph::update, roots moved (pool)", &roots, pool },
+      { "SceneGraph::update, 16 nodes moved", &spread, NULL },
+      { "SceneGraph::update, none moved", &none, NULL },
+    };
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+      const Case& test = cases[c];
+      BenchCase bench = { test.name, count, (double)count,
+        (double)(sizeof(mat4f) * count) };
+      runner->run(bench, [&] {
+        for (size_t k = 0; k < test.moved->size(); ++k) {
+          size_t id = (*test.moved)[k];
+          graph.set_local(id, locals[id]);
+        }
+        do_not_optimize(graph.update(test.pool));
+      });
+    }
+  }
+
+  void bench_normalized(BenchRunner* runner) {
+    const size_t sizes[] = { 1024, 65536, 1048576 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      size_t count = sizes[s];
+      std::vector<float> values = random_floats(3 * count, 6);
+      std::vector<vec3f> input(count);
+      for (size_t i = 0; i < count; ++i) {
+        input[i] = vec3f(values[3*i], values[3*i + 1], values[3*i + 2]);
+      }
+      std::vector<vec3f> result(count);
+      BenchCase bench = { "normalized", count, (double)count,
+        2.0 * sizeof(vec3f) * count };
+      runner->run(bench, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          result[i] = normalized(input[i]);
+        }
+        do_not_optimize(result[0]);
+      });
+      BenchCase fast = { "normalized_fast", count, (double)count,
+        2.0 * sizeof(vec3f) * count };
+      runner->run(fast, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          result[i] = normalized_fast(input[i]);
+        }
+        do_not_optimize(result[0]);
+      });
+    }
+  }
+
+  void bench_sphere_generate(BenchRunner* runner) {
+    const size_t qualities[] = { 8, 32, 128 };
+    for (size_t s = 0; s < sizeof(qualities) / sizeof(qualities[0]); ++s) {
+      size_t quality = qualities[s];
+      Mesh probe = sphere::generate(1.f, quality);
+      BenchCase bench = { "sphere::generate", probe.vertexes.size(),
+        (double)probe.vertexes.size(),
+        (double)(sizeof(vec3f) * probe.vertexes.size()
+          + sizeof(unsigned) * probe.indexes.size()) };
+      runner->run(bench, [&] {
+        Mesh mesh = sphere::generate(1.f, quality);
+        do_not_optimize(mesh.vertexes[0]);
+      });
+    }
+  }
+
+  void bench_mesh(BenchRunner* runner) {
+    const size_t qualities[] = { 8, 32, 128 };
+    for (size_t s = 0; s < sizeof(qualities) / sizeof(qualities[0]); ++s) {
+      Mesh mesh = sphere::generate(1.f, qualities[s]);
+      size_t vertex_count = mesh.vertexes.size();
+      size_t face_count = mesh.indexes.size() / 3;
+      // indexes and vertexes in, face and vertex normals out
+      double bytes = (double)(sizeof(unsigned) * mesh.indexes.size()
+        + 3 * sizeof(vec3f) * mesh.indexes.size()
+        + sizeof(vec3f) * (face_count + vertex_count));
+
+      BenchCase normals = { "Mesh::calculate_normals", vertex_count,
+        (double)face_count, bytes };
+      runner->run(normals, [&] {
+        mesh.calculate_normals();
+        do_not_optimize(mesh.vertex_normals[0]);
+      });
+
+      BenchCase weighted = { "Mesh::calculate_weighted_normals", vertex_count,
+        (double)face_count, bytes };
+      runner->run(weighted, [&] {
+        mesh.calculate_weighted_normals();
+        do_not_optimize(mesh.vertex_normals[0]);
+      });
+
+      BenchCase weighted_fast = { "Mesh::calculate_weighted_normals (fast)",
+        vertex_count, (double)face_count, bytes };
+      runner->run(weighted_fast, [&] {
+        mesh.calculate_weighted_normals(MATH_FAST);
+        do_not_optimize(mesh.vertex_normals[0]);
+      });
+
+      BenchCase box = { "Mesh::get_bounding_box", vertex_count,
+        (double)vertex_count, (double)(sizeof(vec3f) * vertex_count) };
+      runner->run(box, [&] {
+        Box result = mesh.get_bounding_box();
+        do_not_optimize(result);
+      });
+    }
+
+    // simplify compares every pair of vertexes, so stay small
+    const size_t simplify_qualities[] = { 4, 8, 16 };
+    for (size_t s = 0; s < sizeof(simplify_qualities) / sizeof(simplify_qualities[0]); ++s) {
+      const Mesh source = unwelded(sphere::generate(1.f, simplify_qualities[s]));
+      size_t vertex_count = source.vertexes.size();
+      Mesh mesh;
+      BenchCase simplify = { "Mesh::simplify", vertex_count,
+        (double)vertex_count,
+        (double)(sizeof(vec3f) * vertex_count
+          + 2 * sizeof(unsigned) * source.indexes.size()) };
+      runner->run_with_setup(simplify, [&] { mesh = source; }, [&] {
+        mesh.simplify();
+        do_not_optimize(mesh.vertexes[0]);
+      });
+    }
+  }
+
+  void bench_transform(BenchRunner* runner, ThreadPool* pool) {
+    const size_t qualities[] = { 32, 128, 512 };
+    mat4f m = bake_transform();
+    mat3f nm = normal_matrix(m);
+    for (size_t s = 0; s < sizeof(qualities) / sizeof(qualities[0]); ++s) {
+      Mesh mesh = sphere::generate(1.f, qualities[s]);
+      mesh.calculate_normals();
+      size_t count = mesh.vertexes.size();
+      std::vector<vec3f> result(count);
+      double bytes = 2.0 * sizeof(vec3f) * count;
+
+      BenchCase loop = { "mat4f * vec4f per vertex", count, (double)count, bytes };
+      runner->run(loop, [&] {
+        for (size_t i = 0; i < count; ++i) {
+          result[i] = (m * vec4f(mesh.vertexes[i], 1)).xyz();
+        }
+        do_not_optimize(result[0]);
+      });
+
+      BenchCase points = { "transform_points", count, (double)count, bytes };
+      runner->run(points, [&] {
+        transform_points(m, &mesh.vertexes[0], count, &result[0], NULL);
+        do_not_optimize(result[0]);
+      });
+
+      BenchCase pooled = { "transform_points (pool)", count, (double)count, bytes };
+      runner->run(pooled, [&] {
+        transform_points(m, &mesh.vertexes[0], count, &result[0], pool);
+        do_not_optimize(result[0]);
+      });
+
+      BenchCase normals = { "transform_normals", count, (double)count, bytes };
+      runner->run(normals, [&] {
+        transform_normals(nm, &mesh.vertex_normals[0], count, &result[0], NULL);
+        do_not_optimize(result[0]);
+      });
+
+      Mesh out;
+      BenchCase whole = { "transform_mesh (pool)", count, (double)count,
+        2.0 * sizeof(vec3f) * (2 * count + mesh.face_normals.size()) };
+      runner->run(whole, [&] {
+        transform_mesh(m, mesh, &out, pool);
+        do_not_optimize(out.vertexes[0]);
+      });
+    }
+  }
+
+  void bench_face_normals(BenchRunner* runner) {
+    const size_t qualities[] = { 32, 128 };
+    for (size_t s = 0; s < sizeof(qualities) / sizeof(qualities[0]); ++s) {
+      Mesh mesh = sphere::generate(1.f, qualities[s]);
+      size_t face_count = mesh.indexes.size() / 3;
+      std::vector<vec3f> normals(face_count);
+      double bytes = (double)(sizeof(unsigned) * mesh.indexes.size()
+        + 4 * sizeof(vec3f) * face_count);
+      struct Width {
+        const char* name;
+        void (*kernel)(const Mesh&, vec3f*);
+      };
+      const Width widths[] = {
+        { "face normals vec3f", face_normals },
+        { "face normals vec3f_x4", face_normals_x<4> },
+        { "face normals vec3f_x8", face_normals_x<8> },
+        { "face normals vec3f_x16", face_normals_x<16> },
+      };
+      for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); ++w) {
+        BenchCase bench = { widths[w].name, face_count, (double)face_count, bytes };
+        runner->run(bench, [&] {
+          widths[w].kernel(mesh, &normals[0]);
+          do_not_optimize(normals[0]);
+        });
+      }
+    }
+  }
+
+  // Names made up at run time, which outlive the runner's pointers to them.
+  const char* bench_name(const char* kernel, const char* isa) {
+    static std::deque<std::string> names;
+    names.push_back(std::string(kernel) + " " + isa);
+    return names.back().c_str();
+  }
+
+  // Each kernel of each table this CPU runs, whatever cpu_kernels() is
+  // bound to.
+  void bench_cpu_kernels(BenchRunner* runner) {
+    Mesh mesh = sphere::generate(1.f, 128);
+    const float* vertexes = mesh.vertexes[0].data();
+    size_t vertex_count = mesh.vertexes.size();
+    size_t face_count = mesh.indexes.size() / 3;
+    std::vector<float> result(3 * std::max(vertex_count, face_count));
+    float affine[12];
+    memcpy(affine, bake_transform().data.data(), sizeof(affine));
+    FieldCase field;
+    init_field_case(256, 64, 64, &field);
+    const size_t quaternion_count = 65536;
+    std::vector<quaternion> from, to;
+    random_keyframes(quaternion_count, 17, &from, &to);
+    std::vector<quaternion> rotations(quaternion_count);
+    std::vector<mat4f> matrices(quaternion_count);
+
+    for (size_t t = 0; t < cpu_kernel_table_count(); ++t) {
+      const CpuKernels& kernels = cpu_kernel_table(t);
+      if (!cpu_supports(kernels.isa)) {
+        continue;
+      }
+      bench_matrix_kernel(runner, bench_name("m4f_mul_m4fo", kernels.name),
+        kernels.m4f_mul_m4fo, 16, 16, 16);
+      bench_matrix_kernel(runner, bench_name("m4f_mul_v4fo", kernels.name),
+        kernels.m4f_mul_v4fo, 16, 4, 4);
+
+      double bytes = 2.0 * sizeof(vec3f) * vertex_count;
+      BenchCase points = { bench_name("transform_points", kernels.name),
+        vertex_count, (double)vertex_count, bytes };
+      runner->run(points, [&] {
+        kernels.transform_points(affine, vertexes, vertex_count, &result[0]);
+        do_not_optimize(result[0]);
+      });
+
+      BenchCase normals = { bench_name("transform_normals", kernels.name),
+        vertex_count, (double)vertex_count, bytes };
+      runner->run(normals, [&] {
+        kernels.transform_normals(affine, vertexes, vertex_count, &result[0]);
+        do_not_optimize(result[0]);
+      });
+
+      BenchCase faces = { bench_name("face_normals", kernels.name), face_count,
+        (double)face_count,
+        (double)(sizeof(unsigned) * mesh.indexes.size() + 4 * sizeof(vec3f) * face_count) };
+      runner->run(faces, [&] {
+        kernels.face_normals(vertexes, &mesh.indexes[0], face_count, &result[0]);
+        do_not_optimize(result[0]);
+      });
+
+      BenchCase box = { bench_name("bounding_box", kernels.name), vertex_count,
+        (double)vertex_count, (double)(sizeof(vec3f) * vertex_count) };
+      runner->run(box, [&] {
+        kernels.bounding_box(vertexes, vertex_count, &result[0], &result[3]);
+        do_not_optimize(result[0]);
+      });
+
+      size_t samples = field.field.size();
+      BenchCase gaussian = { bench_name("field_block gaussian", kernels.name), samples,
+        (double)(samples * field.block.source_count), (double)(sizeof(float) * samples) };
+      runner->run(gaussian, [&] {
+        kernels.field_block[KERNEL_GAUSSIAN](field.block);
+        do_not_optimize(field.field[0]);
+      });
+
+      BenchCase to_mat4f = { bench_name("quaternions_to_mat4f", kernels.name),
+        quaternion_count, (double)quaternion_count,
+        (double)(sizeof(quaternion) + sizeof(mat4f)) * quaternion_count };
+      runner->run(to_mat4f, [&] {
+        kernels.quaternions_to_mat4f(floats(&from[0]), quaternion_count, matrices[0]);
+        do_not_optimize(matrices[0]);
+      });
+
+      BenchCase slerp = { bench_name("slerp_quaternions", kernels.name),
+        quaternion_count, (double)quaternion_count,
+        3.0 * sizeof(quaternion) * quaternion_count };
+      runner->run(slerp, [&] {
+        kernels.slerp_quaternions(floats(&from[0]), floats(&to[0]), 0.3f,
+          quaternion_count, floats(&rotations[0]));
+        do_not_optimize(rotations[0]);
+      });
+    }
+  }
+
+  void print_usage(const char* program) {
+    fprintf(stderr,
+      "usage: %s [--format text|csv|json] [--filter NAME] [--repetitions N]\n"
+      "          [--min-sample-ms MS] [--warmup-ms MS]\n"
+      "          [--cpu-isa auto|avx512|avx2|sse2|neon|scalar]\n",
+      program);
+  }
+}
+
+int main(int argc, char** argv) {
+  BenchConfig config;
+  config.warmup_ms = 20;
+  config.min_sample_ms = 2;
+  config.repetitions = 15;
+  config.filter = NULL;
+  BenchFormat format = BENCH_TEXT;
+
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 >= argc) {
+      print_usage(argv[0]);
+      return 1;
+    }
+    const char* option = argv[i];
+    const char* value = argv[++i];
+    if (strcmp(option, "--format") == 0) {
+      if (strcmp(value, "text") == 0) {
+        format = BENCH_TEXT;
+      } else if (strcmp(value, "csv") == 0) {
+        format = BENCH_CSV;
+      } else if (strcmp(value, "json") == 0) {
+        format = BENCH_JSON;
+      } else {
+        print_usage(argv[0]);
+        return 1;
+      }
+    } else if (strcmp(option, "--filter") == 0) {
+      config.filter = value;
+    } else if (strcmp(option, "--repetitions") == 0) {
+      config.repetitions = std::max(1, atoi(value));
+    } else if (strcmp(option, "--min-sample-ms") == 0) {
+      config.min_sample_ms = atof(value);
+    } else if (strcmp(option, "--warmup-ms") == 0) {
+      config.warmup_ms = atof(value);
+    } else if (strcmp(option, "--cpu-isa") == 0) {
+      if (!force_cpu_isa(value)) {
+        return 1;
+      }
+    } else {
+      print_usage(argv[0]);
+      return 1;
+    }
+  }
+
+  bool checked = check_vector_math();
+  checked = check_mesh_transform() && checked;
+  checked = check_vec3f_x() && checked;
+  checked = check_constexpr() && checked;
+  checked = check_vec() && checked;
+  checked = check_fast_math() && checked;
+  checked = check_cpu_kernels() && checked;
+
+  ThreadPool pool;
+  pool.init(ThreadPool::default_worker_count());
+  checked = check_quaternion_batch(&pool) && checked;
+  checked = check_scene_graph(&pool) && checked;
+  checked = check_field_eval(&pool) && checked;
+  checked = check_colormap_field(&pool) && checked;
+  if (!checked) {
+    pool.cleanup();
+    return 1;
+  }
+
+  BenchRunner runner(config);
+  bench_m4f_mul_m4fo(&runner);
+  bench_view_matrix(&runner);
+  bench_vec3f_expressions(&runner);
+  bench_m3f_mul_av3fo(&runner);
+  bench_quaternion_to_mat4f(&runner);
+  bench_quaternion_batch(&runner, &pool);
+  bench_scene_graph(&runner, &pool);
+  bench_normalized(&runner);
+  bench_sphere_generate(&runner);
+  bench_mesh(&runner);
+  bench_transform(&runner, &pool);
+  bench_face_normals(&runner);
+  bench_cpu_kernels(&runner);
+  runner.print(format);
+  pool.cleanup();
+  return 0;
+}
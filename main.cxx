@@ -1,6 +1,10 @@
 #include <string.h>
 #include <errno.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <vector>
 
 #include <glad/glad.h>
@@ -8,18 +12,64 @@
 
 #include "math/matrix_math.h"
 #include "math/quaternion.h"
+#include "misc/camera_script.h"
 #include "misc/colormap.h"
+#include "misc/cpu_dispatch.h"
+#include "misc/field_eval.h"
+#include "misc/image_io.h"
+#include "misc/input_record.h"
+#include "misc/kernel_table.h"
+#include "misc/kernels.h"
+#include "misc/thread_pool.h"
+#include "misc/trace.h"
+#include "opengl/field_range.h"
+#include "opengl/frame_timer.h"
+#include "opengl/gl_counters.h"
+#include "opengl/gl_debug.h"
+#include "opengl/gl_profiler.h"
+#include "opengl/gpu_memory.h"
+#ifdef GRAD_HEADLESS
+#include "opengl/headless_context.h"
+#endif
+#include "opengl/hud.h"
 #include "opengl/opengl_common.h"
+#include "opengl/render_target.h"
 #include "opengl/shader_program.h"
 
+GLFWwindow* g_window;
 bool g_pause = false;
 bool g_wireframe = false;
 bool g_dirty = true;
 bool g_panning = false;
 bool g_rotating = false;
 vec2f g_drag_prev;
+double g_cursor_x = 0;
+double g_cursor_y = 0;
+
+enum RenderPath {
+  RENDER_PER_PIXEL,
+  RENDER_SPLAT,
+};
+RenderPath g_render_path = RENDER_PER_PIXEL;
+
+enum KernelSource {
+  KERNEL_ANALYTIC,
+  KERNEL_TABLE,
+  KERNEL_SOURCE_COUNT,
+};
+KernelSource g_kernel_source = KERNEL_ANALYTIC;
+KernelType g_kernel_type = KERNEL_SPIKY;
+size_t g_kernel_table_resolution = 256;
 
-vec2f g_pan = {0,0};
+enum RangeMode {
+  RANGE_FIXED,
+  RANGE_MINMAX,
+  RANGE_PERCENTILE,
+};
+RangeMode g_range_mode = RANGE_FIXED;
+
+// double so that small drags still add up when zoomed far in
+vec2d g_pan = {0,0};
 quaternion g_orient = quaternion::rotation(0, vec3f{0,0,1});
 
 const float k_lines[] = {
@@ -30,26 +80,146 @@ const float k_lines[] = {
 
 extern const char* const k_shaders_gradient_vert;
 extern const char* const k_shaders_gradient_frag;
+extern const char* const k_shaders_field_frag;
+extern const char* const k_shaders_kernel_glsl;
+extern const char* const k_shaders_kernel_table_glsl;
+extern const char* const k_shaders_splat_vert;
+extern const char* const k_shaders_splat_frag;
+extern const char* const k_shaders_resolve_frag;
 
 struct GradientShaderParams {
   enum {
     MVP_VID,
     LINE_VID,
     COLORMAP_FID,
+    COLORMAP_LAYER_FID,
     COUNT,
   };
   ShaderProgram shader;
   GLint ids[COUNT];
-} g_gradient;
+} g_gradient[KERNEL_TYPE_COUNT][KERNEL_SOURCE_COUNT];
 
 const char* k_gradient_attributes[GradientShaderParams::COUNT] = {
   "v_mvp",
   "f_line",
   "f_colormap",
+  "f_colormap_layer",
+};
+
+struct FieldShaderParams {
+  enum {
+    MVP_VID,
+    LINE_VID,
+    COUNT,
+  };
+  ShaderProgram shader;
+  GLint ids[COUNT];
+} g_field[KERNEL_TYPE_COUNT][KERNEL_SOURCE_COUNT];
+
+const char* k_field_attributes[FieldShaderParams::COUNT] = {
+  "v_mvp",
+  "f_line",
+};
+
+struct SplatShaderParams {
+  enum {
+    MVP_VID,
+    COUNT,
+  };
+  ShaderProgram shader;
+  GLint ids[COUNT];
+} g_splat[KERNEL_TYPE_COUNT][KERNEL_SOURCE_COUNT];
+
+const char* k_splat_attributes[SplatShaderParams::COUNT] = {
+  "v_mvp",
+};
+
+struct ResolveShaderParams {
+  enum {
+    MVP_VID,
+    FIELD_FID,
+    COLORMAP_FID,
+    COLORMAP_LAYER_FID,
+    RANGE_FID,
+    COUNT,
+  };
+  ShaderProgram shader;
+  GLint ids[COUNT];
+} g_resolve;
+
+const char* k_resolve_attributes[ResolveShaderParams::COUNT] = {
+  "v_mvp",
+  "f_field",
+  "f_colormap",
+  "f_colormap_layer",
+  "f_range",
 };
 
 GLuint g_varray_id;
-GLuint g_viridis_id;
+GLuint g_quad_buffer_id;
+GLuint g_splat_varray_id;
+GLuint g_splat_source_buffer_id;
+GLuint g_colormap_id;
+ColormapId g_colormap = COLORMAP_VIRIDIS;
+GLuint g_kernel_table_id;
+RenderTarget g_field_target;
+FieldRangeReducer g_range_reducer;
+
+enum TimedSection {
+  TIME_FRAME,
+  TIME_UPDATE_WORLD,
+  TIME_POLL_EVENTS,
+  TIME_DISPLAY,
+  TIME_SWAP_BUFFERS,
+  TIME_SECTION_COUNT,
+};
+
+const char* const k_timed_section_names[TIME_SECTION_COUNT] = {
+  "frame",
+  "update_world",
+  "poll_events",
+  "display",
+  "swap_buffers",
+};
+
+enum TimedPass {
+  PASS_FIELD,
+  PASS_ACCUMULATE,
+  PASS_RANGE,
+  PASS_RESOLVE,
+  PASS_HUD,
+  PASS_COUNT,
+};
+
+const char* const k_timed_pass_names[PASS_COUNT] = {
+  "field",
+  "accumulate",
+  "range",
+  "resolve",
+  "hud",
+};
+
+FrameTimer g_frame_timer;
+const char* g_frame_times_filename = NULL;
+const char* g_trace_filename = NULL;
+
+InputRecorder g_input_recorder;
+InputReplay g_input_replay;
+bool g_replaying = false;
+ReplayPace g_replay_pace = REPLAY_BY_FRAME;
+uint32_t g_input_frame = 0;
+std::chrono::steady_clock::time_point g_input_start;
+
+Hud g_hud;
+bool g_show_hud = false;
+GlCounts g_gl_counts;
+GlMemory g_gl_memory;
+bool g_gl_debug = false;
+GlDebugCounts g_gl_debug_counts;
+GpuMemoryChurn g_gpu_memory_churn;
+size_t g_hud_frame = 0;
+const size_t k_hud_graph_frames = 120;
+const size_t k_hud_memory_interval = 30;  // frames between memory queries
 
 float g_aspect_scale_x = 1.0;
 float g_aspect_scale_y = 1.0;
@@ -59,29 +229,270 @@ int g_frame_size_x = g_window_size_x;
 int g_frame_size_y = g_window_size_y;
 float g_scale = 1.f;
 
-void display() {
+const GLint k_kernel_table_unit = 2;
+
+void bind_kernel_table() {
+  glActiveTexture(GL_TEXTURE0 + k_kernel_table_unit);
+  glBindTexture(GL_TEXTURE_1D, g_kernel_table_id);
+  glActiveTexture(GL_TEXTURE0 + 0);
+}
+
+GradientShaderParams& gradient_variant(KernelType type, KernelSource source);
+FieldShaderParams& field_variant(KernelType type, KernelSource source);
+SplatShaderParams& splat_variant(KernelType type, KernelSource source);
+
+// Evaluates the kernel sum over every source for each pixel of the quad.
+void draw_field_per_pixel(const mat4f& mvp) {
+  GradientShaderParams& gradient = gradient_variant(g_kernel_type, g_kernel_source);
+  gradient.shader.use();
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glBindTexture(GL_TEXTURE_1D_ARRAY, g_colormap_id);
+  gradient.shader.set_uniform(gradient.ids[GradientShaderParams::MVP_VID], mvp);
+  glUniform1i(gradient.ids[GradientShaderParams::COLORMAP_LAYER_FID], g_colormap);
+  glUniform2fv(gradient.ids[GradientShaderParams::LINE_VID], 3, k_lines);
+  glBindVertexArray(g_varray_id);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+// Writes the raw kernel sum for each pixel of the quad into the field target.
+void accumulate_field_per_pixel(const mat4f& mvp) {
+  g_field_target.resize(g_frame_size_x, g_frame_size_y);
+  g_field_target.bind();
+  glClearColor(0,0,0,0);
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  FieldShaderParams& field = field_variant(g_kernel_type, g_kernel_source);
+  field.shader.use();
+  field.shader.set_uniform(field.ids[FieldShaderParams::MVP_VID], mvp);
+  glUniform2fv(field.ids[FieldShaderParams::LINE_VID], 3, k_lines);
+  glBindVertexArray(g_varray_id);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+// Additively blends one kernel footprint per source into the field target.
+void accumulate_field_splat(const mat4f& mvp) {
+  g_field_target.resize(g_frame_size_x, g_frame_size_y);
+  g_field_target.bind();
+  glClearColor(0,0,0,0);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glEnable(GL_BLEND);
+  glBlendEquation(GL_FUNC_ADD);
+  glBlendFunc(GL_ONE, GL_ONE);
+
+  SplatShaderParams& splat = splat_variant(g_kernel_type, g_kernel_source);
+  splat.shader.use();
+  splat.shader.set_uniform(splat.ids[SplatShaderParams::MVP_VID], mvp);
+  glBindVertexArray(g_splat_varray_id);
+  glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, sizeof(k_lines) / (2 * sizeof(float)));
+
+  glDisable(GL_BLEND);
+}
+
+void field_colormap_range(float* range) {
+  const FieldRange& auto_range = g_range_reducer.range();
+  if (g_range_mode == RANGE_MINMAX) {
+    range[0] = auto_range.min;
+    range[1] = auto_range.max;
+  } else if (g_range_mode == RANGE_PERCENTILE) {
+    range[0] = auto_range.low;
+    range[1] = auto_range.high;
+  } else {
+    range[0] = 0;
+    range[1] = 1;
+  }
+  if (range[1] <= range[0]) {
+    range[1] = range[0] + 1e-6f;
+  }
+}
+
+// Colours the quad from the accumulated field in a single pass.
+void resolve_field(const mat4f& mvp) {
+  RenderTarget::unbind();
   glViewport(0, 0, g_frame_size_x, g_frame_size_y);
-  glClearColor(0,0,0,1);
-  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+  float range[2];
+  field_colormap_range(range);
+
+  g_resolve.shader.use();
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glBindTexture(GL_TEXTURE_1D_ARRAY, g_colormap_id);
+  glActiveTexture(GL_TEXTURE0 + 1);
+  glBindTexture(GL_TEXTURE_2D, g_field_target.texture());
+  g_resolve.shader.set_uniform(g_resolve.ids[ResolveShaderParams::MVP_VID], mvp);
+  glUniform1i(g_resolve.ids[ResolveShaderParams::COLORMAP_LAYER_FID], g_colormap);
+  glUniform2fv(g_resolve.ids[ResolveShaderParams::RANGE_FID], 1, range);
+  glBindVertexArray(g_varray_id);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+  glActiveTexture(GL_TEXTURE0 + 0);
+}
+
+void draw_field(const mat4f& mvp) {
+  if (g_kernel_source == KERNEL_TABLE) {
+    bind_kernel_table();
+  }
+  if (g_render_path == RENDER_PER_PIXEL && g_range_mode == RANGE_FIXED) {
+    g_frame_timer.begin_gpu(PASS_FIELD);
+    draw_field_per_pixel(mvp);
+    g_frame_timer.end_gpu(PASS_FIELD);
+    return;
+  }
+
+  g_frame_timer.begin_gpu(PASS_ACCUMULATE);
+  if (g_render_path == RENDER_SPLAT) {
+    accumulate_field_splat(mvp);
+  } else {
+    accumulate_field_per_pixel(mvp);
+  }
+  g_frame_timer.end_gpu(PASS_ACCUMULATE);
+  if (g_range_mode != RANGE_FIXED) {
+    // the range found here is used from the frame it arrives in
+    g_frame_timer.begin_gpu(PASS_RANGE);
+    g_range_reducer.resize(g_frame_size_x, g_frame_size_y);
+    g_range_reducer.reduce(g_field_target.texture(), mvp, g_varray_id);
+    g_frame_timer.end_gpu(PASS_RANGE);
+  }
+  g_frame_timer.begin_gpu(PASS_RESOLVE);
+  resolve_field(mvp);
+  g_frame_timer.end_gpu(PASS_RESOLVE);
+}
+
+// Frame time graphs and the GL work of the previous frame, in the top-left
+// corner of the window.
+void draw_hud() {
+  TRACE_ZONE("draw_hud");
+  if (g_hud_frame++ % k_hud_memory_interval == 0) {
+    g_gl_memory = gl_counters_memory();
+  }
+
+  float cpu[k_hud_graph_frames];
+  float gpu[k_hud_graph_frames];
+  float pass[k_hud_graph_frames];
+  g_frame_timer.recent_cpu(TIME_FRAME, k_hud_graph_frames, cpu);
+  std::fill(gpu, gpu + k_hud_graph_frames, NAN);
+  for (size_t p = 0; p < PASS_COUNT; ++p) {
+    g_frame_timer.recent_gpu(p, k_hud_graph_frames, pass);
+    for (size_t i = 0; i < k_hud_graph_frames; ++i) {
+      if (!std::isnan(pass[i])) {
+        gpu[i] = std::isnan(gpu[i]) ? pass[i] : gpu[i] + pass[i];
+      }
+    }
+  }
+  // both graphs share a scale, from the slowest recent frame
+  float scale = 1;
+  for (size_t i = 0; i < k_hud_graph_frames; ++i) {
+    scale = std::isnan(cpu[i]) ? scale : std::max(scale, cpu[i]);
+    scale = std::isnan(gpu[i]) ? scale : std::max(scale, gpu[i]);
+  }
+  float last_cpu = cpu[k_hud_graph_frames - 1];
+  float last_gpu = NAN;
+  for (size_t i = k_hud_graph_frames; i > 0 && std::isnan(last_gpu); --i) {
+    last_gpu = gpu[i - 1];
+  }
+
+  const uint32_t k_panel = 0x000000b0;
+  const uint32_t k_label = 0xe0e0e0ff;
+  const uint32_t k_cpu = 0xffa040ff;
+  const uint32_t k_gpu = 0x40c0ffff;
+  const float pad = 8;
+  const float graph_width = 2 * k_hud_graph_frames;
+  const float graph_height = 48;
+  const float line = g_hud.line_height();
+
+  char uploaded[32];
+  format_bytes(g_gl_counts.upload_bytes, uploaded, sizeof(uploaded));
+  char memory[80];
+  if (g_gl_memory.have_used) {
+    char used[32], total[32];
+    format_bytes(1024.0 * g_gl_memory.used_kb, used, sizeof(used));
+    format_bytes(1024.0 * g_gl_memory.total_kb, total, sizeof(total));
+    snprintf(memory, sizeof(memory), "%s of %s", used, total);
+  } else if (g_gl_memory.have_free) {
+    char free[32];
+    format_bytes(1024.0 * g_gl_memory.free_kb, free, sizeof(free));
+    snprintf(memory, sizeof(memory), "%s free", free);
+  } else {
+    snprintf(memory, sizeof(memory), "n/a");
+  }
+
+  GpuMemoryUsage tracked_usage = gpu_memory_total();
+  char tracked[32], tracked_peak[32];
+  format_bytes(tracked_usage.bytes, tracked, sizeof(tracked));
+  format_bytes(tracked_usage.peak_bytes, tracked_peak, sizeof(tracked_peak));
+
+  char text[512];
+  snprintf(text, sizeof(text),
+    "draw calls     %zu\n"
+    "state changes  %zu\n"
+    "uploaded       %s\n"
+    "gpu memory     %s\n"
+    "tracked        %s, peak %s\n"
+    "churn          %zu allocs, %zu frees",
+    g_gl_counts.draw_calls, g_gl_counts.state_changes, uploaded, memory,
+    tracked, tracked_peak,
+    g_gpu_memory_churn.allocations, g_gpu_memory_churn.releases);
+
+  float x = 2 * pad;
+  float y = 2 * pad;
+  float panel_width = std::max(graph_width, 40 * g_hud.glyph_advance()) + 2 * pad;
+  size_t text_lines = gl_debug_installed() ? 7 : 6;
+  float panel_height = 2 * line + graph_height + pad + text_lines * line + 2 * pad;
+
+  g_hud.clear();
+  g_hud.box(pad, pad, panel_width, panel_height, k_panel);
+  char times[128];
+  snprintf(times, sizeof(times), "cpu %6.2f ms", last_cpu);
+  g_hud.text(x, y, times, k_cpu);
+  snprintf(times, sizeof(times), "gpu %6.2f ms", last_gpu);
+  g_hud.text(x + 15 * g_hud.glyph_advance(), y, times, k_gpu);
+  y += line;
+  snprintf(times, sizeof(times), "scale %.2f ms", scale);
+  g_hud.text(x, y, times, k_label);
+  y += line;
+  g_hud.box(x, y, graph_width, graph_height, 0x202020c0);
+  g_hud.graph(x, y, graph_width, graph_height, cpu, k_hud_graph_frames, scale, k_cpu);
+  g_hud.graph(x, y, graph_width, graph_height, gpu, k_hud_graph_frames, scale, k_gpu);
+  y += graph_height + pad;
+  g_hud.text(x, y, text, k_label);
+  if (gl_debug_installed()) {
+    y += 6 * line;
+    snprintf(text, sizeof(text), "gl warnings    %zu perf, %zu errors",
+      g_gl_debug_counts.performance, g_gl_debug_counts.errors);
+    g_hud.text(x, y, text,
+      g_gl_debug_counts.performance + g_gl_debug_counts.errors ? k_cpu : k_label);
+  }
+
+  g_frame_timer.begin_gpu(PASS_HUD);
+  g_hud.draw(g_frame_size_x, g_frame_size_y);
+  g_frame_timer.end_gpu(PASS_HUD);
+}
+
+// The projection and view of the quad for g_scale, g_pan and g_orient.
+mat4f view_projection() {
   mat4f p = mat4f::ortho()
     * mat4f::scale({g_scale, g_scale, g_scale})
     * mat4f::scale({g_aspect_scale_x, g_aspect_scale_y, 1});
-  mat4f v = mat4f::trans({g_pan.x(), g_pan.y(), 0})
+  mat4f v = mat4f::trans({float(g_pan.x()), float(g_pan.y()), 0.f})
     * g_orient.to_mat4f();
+  return p * v;
+}
 
-  mat4f mvp = p * v;
+void display() {
+  TRACE_ZONE("display");
+  RenderTarget::unbind();
+  glViewport(0, 0, g_frame_size_x, g_frame_size_y);
+  glClearColor(0,0,0,1);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-  g_gradient.shader.use();
-  glActiveTexture(GL_TEXTURE0 + 0);
-  glBindTexture(GL_TEXTURE_1D, g_viridis_id);
-  g_gradient.shader.set_uniform(g_gradient.ids[GradientShaderParams::MVP_VID], mvp);
-  glUniform2fv(g_gradient.ids[GradientShaderParams::LINE_VID], 3, k_lines);
-  glBindVertexArray(g_varray_id);
-  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+  mat4f mvp = view_projection();
+
+  draw_field(mvp);
+  if (g_show_hud) {
+    draw_hud();
+  }
 }
 
 void update_world() {
+  TRACE_ZONE("update_world");
   if (g_pause) {
     return;
   }
@@ -105,28 +516,190 @@ void query_uniform_locations(ShaderProgram* shader, size_t count,
   }
 }
 
+// Every colormap lives in one layer of a 1D array texture, so switching maps
+// only changes the f_colormap_layer uniform.
 void init_colormap() {
   glActiveTexture(GL_TEXTURE0 + 0);
 
-  glGenTextures(1, &g_viridis_id);
-  glBindTexture(GL_TEXTURE_2D, g_viridis_id);
+  std::vector<unsigned char> texels(4 * k_colormap_width * COLORMAP_COUNT);
+  pack_colormaps_rgba8(texels.data());
+
+  glGenTextures(1, &g_colormap_id);
+  glBindTexture(GL_TEXTURE_1D_ARRAY, g_colormap_id);
 
-  glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA, k_viridis_count, 0,
-    GL_RGB, GL_FLOAT, k_viridis);
+  glTexImage2D(GL_TEXTURE_1D_ARRAY, 0, GL_RGBA8, k_colormap_width, COLORMAP_COUNT, 0,
+    GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+  glTexParameteri(GL_TEXTURE_1D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_1D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_1D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_1D_ARRAY, 0);
+  gpu_memory_allocate(GPU_OBJECT_TEXTURE, g_colormap_id, GPU_MEMORY_TEXTURE,
+    gpu_memory_texture_bytes(GL_RGBA8, k_colormap_width, COLORMAP_COUNT, 1), "colormaps");
+}
+
+void upload_kernel_table() {
+  const KernelInfo& kernel = k_kernels[g_kernel_type];
+  std::vector<float> texels(2 * g_kernel_table_resolution);
+  bake_kernel_table(kernel, g_kernel_table_resolution, texels.data());
+  print_kernel_table_error(kernel, g_kernel_table_resolution,
+    measure_kernel_table_error(kernel, texels.data(),
+      g_kernel_table_resolution, 16 * g_kernel_table_resolution));
+
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glBindTexture(GL_TEXTURE_1D, g_kernel_table_id);
+  glTexImage1D(GL_TEXTURE_1D, 0, GL_RG32F, g_kernel_table_resolution, 0,
+    GL_RG, GL_FLOAT, texels.data());
+  glBindTexture(GL_TEXTURE_1D, 0);
+  gpu_memory_allocate(GPU_OBJECT_TEXTURE, g_kernel_table_id, GPU_MEMORY_TEXTURE,
+    gpu_memory_texture_bytes(GL_RG32F, g_kernel_table_resolution, 1, 1), "kernel table");
+}
+
+void init_kernel_table() {
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glGenTextures(1, &g_kernel_table_id);
+  glBindTexture(GL_TEXTURE_1D, g_kernel_table_id);
   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_1D, 0);
+}
+
+void label_variant(const ShaderProgram& shader, const char* name,
+    KernelType type, KernelSource source) {
+  char label[128];
+  snprintf(label, sizeof(label), "%s %s %s", name, k_kernels[type].name,
+    source == KERNEL_TABLE ? "table" : "analytic");
+  shader.set_label(label);
+}
+
+void kernel_variant_files(KernelSource source,
+    const char** kernel_file, const char** kernel_fallback) {
+  if (source == KERNEL_TABLE) {
+    *kernel_file = "shaders/kernel_table.glsl";
+    *kernel_fallback = k_shaders_kernel_table_glsl;
+  } else {
+    *kernel_file = "shaders/kernel.glsl";
+    *kernel_fallback = k_shaders_kernel_glsl;
+  }
+}
+
+// Each kernel type and source is compiled into its own program, with the
+// kernel constants folded in, the first time it is drawn.
+GradientShaderParams& gradient_variant(KernelType type, KernelSource source) {
+  GradientShaderParams& gradient = g_gradient[type][source];
+  if (gradient.shader.is_loaded()) {
+    return gradient;
+  }
+
+  char defines[512];
+  kernel_shader_defines(type, defines, sizeof(defines));
+  const char* kernel_file;
+  const char* kernel_fallback;
+  kernel_variant_files(source, &kernel_file, &kernel_fallback);
+
+  const char* gradient_files[] = {
+    "shaders/gradient.vert", kernel_file, "shaders/gradient.frag" };
+  const char* gradient_fallbacks[] = {
+    k_shaders_gradient_vert, kernel_fallback, k_shaders_gradient_frag };
+  GLenum gradient_types[] = {
+    GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_FRAGMENT_SHADER };
+  gradient.shader.load_with_fallback(gradient_files, gradient_fallbacks,
+      gradient_types, 3, defines);
+  label_variant(gradient.shader, "gradient", type, source);
+  query_uniform_locations(&gradient.shader, GradientShaderParams::COUNT,
+      k_gradient_attributes, gradient.ids);
+  gradient.shader.use();
+  glUniform1i(gradient.shader.uniform_location("f_kernel_table"),
+    k_kernel_table_unit);
+  return gradient;
+}
+
+FieldShaderParams& field_variant(KernelType type, KernelSource source) {
+  FieldShaderParams& field = g_field[type][source];
+  if (field.shader.is_loaded()) {
+    return field;
+  }
+
+  char defines[512];
+  kernel_shader_defines(type, defines, sizeof(defines));
+  const char* kernel_file;
+  const char* kernel_fallback;
+  kernel_variant_files(source, &kernel_file, &kernel_fallback);
+
+  const char* field_files[] = {
+    "shaders/gradient.vert", kernel_file, "shaders/field.frag" };
+  const char* field_fallbacks[] = {
+    k_shaders_gradient_vert, kernel_fallback, k_shaders_field_frag };
+  GLenum field_types[] = {
+    GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_FRAGMENT_SHADER };
+  field.shader.load_with_fallback(field_files, field_fallbacks,
+      field_types, 3, defines);
+  label_variant(field.shader, "field", type, source);
+  query_uniform_locations(&field.shader, FieldShaderParams::COUNT,
+      k_field_attributes, field.ids);
+  field.shader.use();
+  glUniform1i(field.shader.uniform_location("f_kernel_table"),
+    k_kernel_table_unit);
+  return field;
+}
+
+SplatShaderParams& splat_variant(KernelType type, KernelSource source) {
+  SplatShaderParams& splat = g_splat[type][source];
+  if (splat.shader.is_loaded()) {
+    return splat;
+  }
+
+  char defines[512];
+  kernel_shader_defines(type, defines, sizeof(defines));
+  const char* kernel_file;
+  const char* kernel_fallback;
+  kernel_variant_files(source, &kernel_file, &kernel_fallback);
+
+  // the kernel is linked into both stages; the vertex stage needs its support
+  const char* splat_files[] = {
+    "shaders/splat.vert", kernel_file,
+    "shaders/splat.frag", kernel_file };
+  const char* splat_fallbacks[] = {
+    k_shaders_splat_vert, kernel_fallback,
+    k_shaders_splat_frag, kernel_fallback };
+  GLenum splat_types[] = {
+    GL_VERTEX_SHADER, GL_VERTEX_SHADER,
+    GL_FRAGMENT_SHADER, GL_FRAGMENT_SHADER };
+  splat.shader.load_with_fallback(splat_files, splat_fallbacks,
+      splat_types, 4, defines);
+  label_variant(splat.shader, "splat", type, source);
+  query_uniform_locations(&splat.shader, SplatShaderParams::COUNT,
+      k_splat_attributes, splat.ids);
+  splat.shader.use();
+  glUniform1i(splat.shader.uniform_location("f_kernel_table"),
+    k_kernel_table_unit);
+  return splat;
 }
 
 void init() {
   print_opengl_version();
+  gl_counters_install();
+#ifdef GRAD_GL_PROFILE
+  gl_profiler_install();
+#endif
   init_colormap();
+  init_kernel_table();
+
+  g_resolve.shader.load_with_fallback("shaders/gradient.vert", k_shaders_gradient_vert,
+                                      "shaders/resolve.frag", k_shaders_resolve_frag);
+  g_resolve.shader.set_label("resolve");
+  query_uniform_locations(&g_resolve.shader, ResolveShaderParams::COUNT,
+      k_resolve_attributes, g_resolve.ids);
+  g_resolve.shader.use();
+  glUniform1i(g_resolve.ids[ResolveShaderParams::COLORMAP_FID], 0);
+  glUniform1i(g_resolve.ids[ResolveShaderParams::FIELD_FID], 1);
 
-  g_gradient.shader.load_with_fallback("shaders/gradient.vert", k_shaders_gradient_vert,
-                                       "shaders/gradient.frag", k_shaders_gradient_frag);
-  query_uniform_locations(&g_gradient.shader, GradientShaderParams::COUNT,
-      k_gradient_attributes, g_gradient.ids);
+  g_field_target.init(GL_R32F);
+  g_field_target.set_label("field");
+  g_range_reducer.init();
+  g_frame_timer.init(k_timed_section_names, TIME_SECTION_COUNT,
+    k_timed_pass_names, PASS_COUNT);
+  g_hud.init();
 
   const float vbuffer[] = {
     -1.0f,-1.0f, 0.f,
@@ -136,19 +709,79 @@ void init() {
   };
   glGenVertexArrays(1, &g_varray_id);
   glBindVertexArray(g_varray_id);
-  GLuint buffer_id;
-  glGenBuffers(1, &buffer_id);
+  glGenBuffers(1, &g_quad_buffer_id);
 
-  glBindBuffer(GL_ARRAY_BUFFER, buffer_id);
+  glBindBuffer(GL_ARRAY_BUFFER, g_quad_buffer_id);
   glBufferData(GL_ARRAY_BUFFER, sizeof(vbuffer), vbuffer, GL_STATIC_DRAW);
+  gl_debug_label_vertex_array(g_varray_id, "quad");
+  gpu_memory_allocate(GPU_OBJECT_BUFFER, g_quad_buffer_id, GPU_MEMORY_GEOMETRY, sizeof(vbuffer),
+    "quad vertexes");
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+  // the splat path reuses the quad, with one instance per source
+  glGenVertexArrays(1, &g_splat_varray_id);
+  glBindVertexArray(g_splat_varray_id);
   glEnableVertexAttribArray(0);
   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
 
+  glGenBuffers(1, &g_splat_source_buffer_id);
+  glBindBuffer(GL_ARRAY_BUFFER, g_splat_source_buffer_id);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(k_lines), k_lines, GL_STATIC_DRAW);
+  gl_debug_label_vertex_array(g_splat_varray_id, "splat");
+  gpu_memory_allocate(GPU_OBJECT_BUFFER, g_splat_source_buffer_id, GPU_MEMORY_GEOMETRY,
+    sizeof(k_lines), "splat sources");
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, 0);
+  glVertexAttribDivisor(1, 1);
+
   glBindVertexArray(0);
   glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+void delete_buffer(GLuint* id) {
+  gpu_memory_release(GPU_OBJECT_BUFFER, *id);
+  glDeleteBuffers(1, id);
+  *id = 0;
+}
+
+void delete_texture(GLuint* id) {
+  gpu_memory_release(GPU_OBJECT_TEXTURE, *id);
+  glDeleteTextures(1, id);
+  *id = 0;
+}
+
+// Releases everything init() and the shader variants created.
 void cleanup() {
+  g_hud.cleanup();
+  g_frame_timer.cleanup();
+  g_range_reducer.cleanup();
+  g_field_target.cleanup();
+
+  for (size_t type = 0; type < KERNEL_TYPE_COUNT; ++type) {
+    for (size_t source = 0; source < KERNEL_SOURCE_COUNT; ++source) {
+      ShaderProgram* variants[] = {
+        &g_gradient[type][source].shader,
+        &g_field[type][source].shader,
+        &g_splat[type][source].shader,
+      };
+      for (ShaderProgram* shader : variants) {
+        if (shader->is_loaded()) {
+          shader->destroy();
+        }
+      }
+    }
+  }
+  g_resolve.shader.destroy();
+
+  delete_texture(&g_colormap_id);
+  delete_texture(&g_kernel_table_id);
+  delete_buffer(&g_quad_buffer_id);
+  delete_buffer(&g_splat_source_buffer_id);
+  glDeleteVertexArrays(1, &g_varray_id);
+  glDeleteVertexArrays(1, &g_splat_varray_id);
+  g_varray_id = 0;
+  g_splat_varray_id = 0;
 }
 
 void toggle_pause() {
@@ -164,6 +797,120 @@ void toggle_wireframe() {
   }
 }
 
+void toggle_render_path() {
+  if (g_render_path == RENDER_PER_PIXEL) {
+    g_render_path = RENDER_SPLAT;
+    printf("Render path: splat\n");
+  } else {
+    g_render_path = RENDER_PER_PIXEL;
+    printf("Render path: per-pixel\n");
+  }
+  g_dirty = true;
+}
+
+void toggle_kernel_source() {
+  if (g_kernel_source == KERNEL_ANALYTIC) {
+    g_kernel_source = KERNEL_TABLE;
+    printf("Kernel source: table\n");
+    upload_kernel_table();
+  } else {
+    g_kernel_source = KERNEL_ANALYTIC;
+    printf("Kernel source: analytic\n");
+  }
+  g_dirty = true;
+}
+
+void set_kernel_table_resolution(size_t resolution) {
+  g_kernel_table_resolution = std::min(std::max(resolution, size_t(2)), size_t(65536));
+  if (g_kernel_source == KERNEL_TABLE) {
+    upload_kernel_table();
+  }
+  g_dirty = true;
+}
+
+void toggle_hud() {
+  g_show_hud = !g_show_hud;
+  g_dirty = true;
+}
+
+void next_range_mode() {
+  if (g_range_mode == RANGE_FIXED) {
+    g_range_mode = RANGE_MINMAX;
+    printf("Colormap range: min to max\n");
+  } else if (g_range_mode == RANGE_MINMAX) {
+    g_range_mode = RANGE_PERCENTILE;
+    printf("Colormap range: %g%% to %g%%\n",
+      100 * k_range_low_percentile, 100 * k_range_high_percentile);
+  } else {
+    g_range_mode = RANGE_FIXED;
+    printf("Colormap range: 0 to 1\n");
+  }
+  g_dirty = true;
+}
+
+void next_colormap() {
+  g_colormap = ColormapId((g_colormap + 1) % COLORMAP_COUNT);
+  printf("Colormap: %s\n", k_colormap_names[g_colormap]);
+  g_dirty = true;
+}
+
+void next_kernel_type() {
+  g_kernel_type = KernelType((g_kernel_type + 1) % KERNEL_TYPE_COUNT);
+  printf("Kernel: %s\n", k_kernels[g_kernel_type].name);
+  if (g_kernel_source == KERNEL_TABLE) {
+    upload_kernel_table();
+  }
+  g_dirty = true;
+}
+
+void dump_frame_times() {
+  g_frame_timer.print_summary();
+  if (g_frame_times_filename) {
+    g_frame_timer.write(g_frame_times_filename);
+  }
+}
+
+void print_gl_profile() {
+#ifdef GRAD_GL_PROFILE
+  gl_profiler_print_summary();
+#else
+  fprintf(stderr, "Built without the GL profiler; configure with GRAD_GL_PROFILE\n");
+#endif
+}
+
+void end_frame() {
+  ++g_input_frame;
+  g_frame_timer.end_frame();
+  g_gl_counts = gl_counters_end_frame();
+  if (gl_debug_installed()) {
+    g_gl_debug_counts = gl_debug_end_frame();
+  }
+  g_gpu_memory_churn = gpu_memory_end_frame();
+#ifdef GRAD_GL_PROFILE
+  gl_profiler_end_frame();
+#endif
+  TRACE_FRAME_MARK();
+}
+
+// A pass of the main loop that displayed nothing, such as while paused,
+// still counts for replaying input by frame, but stays out of the frame
+// times.
+void end_idle_pass() {
+  ++g_input_frame;
+  g_frame_timer.discard_frame();
+}
+
+void write_trace() {
+  if (!g_trace_filename) {
+    return;
+  }
+#ifdef GRAD_TRACE
+  trace::write_chrome_json(g_trace_filename);
+#else
+  fprintf(stderr, "Built without tracing; configure with GRAD_TRACE\n");
+#endif
+}
+
 void zoom_in() {
   g_scale *= 1.125f;
   g_dirty = true;
@@ -175,7 +922,7 @@ void zoom_out() {
 }
 
 void quit() {
-  exit(0);
+  glfwSetWindowShouldClose(g_window, GL_TRUE);
 }
 
 void key_press(GLFWwindow* window, int key, int scancode, int action,
@@ -193,6 +940,28 @@ void key_press(GLFWwindow* window, int key, int scancode, int action,
     zoom_out();
   } else if (key == GLFW_KEY_W) {
     toggle_wireframe();
+  } else if (key == GLFW_KEY_S) {
+    toggle_render_path();
+  } else if (key == GLFW_KEY_A) {
+    next_range_mode();
+  } else if (key == GLFW_KEY_C) {
+    next_colormap();
+  } else if (key == GLFW_KEY_K) {
+    next_kernel_type();
+  } else if (key == GLFW_KEY_T) {
+    toggle_kernel_source();
+  } else if (key == GLFW_KEY_LEFT_BRACKET) {
+    set_kernel_table_resolution(g_kernel_table_resolution / 2);
+  } else if (key == GLFW_KEY_RIGHT_BRACKET) {
+    set_kernel_table_resolution(g_kernel_table_resolution * 2);
+  } else if (key == GLFW_KEY_F) {
+    dump_frame_times();
+  } else if (key == GLFW_KEY_H) {
+    toggle_hud();
+  } else if (key == GLFW_KEY_G) {
+    print_gl_profile();
+  } else if (key == GLFW_KEY_M) {
+    gpu_memory_print();
   } else if (key == GLFW_KEY_Q) {
     quit();
   } else {
@@ -215,17 +984,16 @@ vec2f editor_window_coord(int x, int y) {
 
 void mouse_press(GLFWwindow* window, int button, int action, int mods) {
   (void)mods;
+  (void)window;
+  // the last reported position rather than glfwGetCursorPos, so that
+  // replayed input does not depend on where the real cursor is
   if (action == GLFW_PRESS) {
     if (button == GLFW_MOUSE_BUTTON_LEFT) {
-      double x, y;
-      glfwGetCursorPos(window, &x, &y);
       g_panning = true;
-      g_drag_prev = editor_window_coord((int)x, (int)y);
+      g_drag_prev = editor_window_coord((int)g_cursor_x, (int)g_cursor_y);
     } else if (button == GLFW_MOUSE_BUTTON_RIGHT) {
-      double x, y;
-      glfwGetCursorPos(window, &x, &y);
       g_rotating = true;
-      g_drag_prev = editor_window_coord((int)x, (int)y);
+      g_drag_prev = editor_window_coord((int)g_cursor_x, (int)g_cursor_y);
     }
   } else if (action == GLFW_RELEASE) {
     if (button == GLFW_MOUSE_BUTTON_LEFT) {
@@ -238,6 +1006,8 @@ void mouse_press(GLFWwindow* window, int button, int action, int mods) {
 
 void mouse_move(GLFWwindow* window, double x, double y) {
   (void)window;
+  g_cursor_x = x;
+  g_cursor_y = y;
   if (g_panning) {
     vec2f coord = editor_window_coord((int)x, (int)y);
     g_pan[0] += 2 * (coord[0] - g_drag_prev[0]) / (g_aspect_scale_x * g_scale);
@@ -250,7 +1020,7 @@ void mouse_move(GLFWwindow* window, double x, double y) {
     float y = (coord[1] - g_drag_prev[1]) / (g_aspect_scale_y * g_scale);
     vec3f axis{y,x,0};
     float m = magnitude(axis);
-    g_orient = quaternion::rotation(m, normalized(axis)) * g_orient;
+    g_orient = normalized(quaternion::rotation(m, normalized(axis)) * g_orient);
     g_drag_prev = coord;
     g_dirty = true;
   }
@@ -278,15 +1048,112 @@ void reshape_window(GLFWwindow* window, int w, int h) {
   g_dirty = true;
 }
 
-GLFWwindow* g_window;
-
 void reshape(int w, int h) {
   reshape_window(g_window, w, h);
 }
 
+uint64_t input_time_us() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - g_input_start).count();
+}
+
+void record_input(InputEventType type, int a, int b, int c, int d,
+    double x, double y) {
+  if (!g_input_recorder.is_open()) {
+    return;
+  }
+  InputEvent event;
+  event.frame = g_input_frame;
+  event.time_us = input_time_us();
+  event.type = type;
+  event.ints[0] = a;
+  event.ints[1] = b;
+  event.ints[2] = c;
+  event.ints[3] = d;
+  event.reals[0] = x;
+  event.reals[1] = y;
+  g_input_recorder.record(event);
+}
+
+// The GLFW callbacks record what they are given before passing it on. Live
+// input is ignored while a recording is replayed, except for window sizes,
+// which replay sets through the window.
+void input_key(GLFWwindow* window, int key, int scancode, int action, int mods) {
+  if (g_replaying) {
+    return;
+  }
+  record_input(INPUT_KEY, key, scancode, action, mods, 0, 0);
+  key_press(window, key, scancode, action, mods);
+}
+
+void input_mouse_button(GLFWwindow* window, int button, int action, int mods) {
+  if (g_replaying) {
+    return;
+  }
+  record_input(INPUT_MOUSE_BUTTON, button, action, mods, 0, 0, 0);
+  mouse_press(window, button, action, mods);
+}
+
+void input_mouse_move(GLFWwindow* window, double x, double y) {
+  if (g_replaying) {
+    return;
+  }
+  record_input(INPUT_MOUSE_MOVE, 0, 0, 0, 0, x, y);
+  mouse_move(window, x, y);
+}
+
+void input_scroll(GLFWwindow* window, double xoffset, double yoffset) {
+  if (g_replaying) {
+    return;
+  }
+  record_input(INPUT_SCROLL, 0, 0, 0, 0, xoffset, yoffset);
+  mouse_scroll(window, xoffset, yoffset);
+}
+
+void input_window_size(GLFWwindow* window, int w, int h) {
+  if (!g_replaying) {
+    record_input(INPUT_WINDOW_SIZE, w, h, 0, 0, 0, 0);
+  }
+  reshape_window(window, w, h);
+}
+
+// Feeds the recorded events that are due, and closes the window once the
+// last one has had a frame to show its effect.
+void replay_input() {
+  if (g_input_replay.done()) {
+    glfwSetWindowShouldClose(g_window, GL_TRUE);
+    return;
+  }
+  InputEvent e;
+  while (g_input_replay.next(g_replay_pace, g_input_frame, input_time_us(), &e)) {
+    switch (e.type) {
+      case INPUT_KEY:
+        key_press(g_window, e.ints[0], e.ints[1], e.ints[2], e.ints[3]);
+        break;
+      case INPUT_MOUSE_BUTTON:
+        mouse_press(g_window, e.ints[0], e.ints[1], e.ints[2]);
+        break;
+      case INPUT_MOUSE_MOVE:
+        mouse_move(g_window, e.reals[0], e.reals[1]);
+        break;
+      case INPUT_SCROLL:
+        mouse_scroll(g_window, e.reals[0], e.reals[1]);
+        break;
+      case INPUT_WINDOW_SIZE:
+        glfwSetWindowSize(g_window, e.ints[0], e.ints[1]);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
 void do_update() {
   update_world();
   glfwPollEvents();
+  if (g_range_reducer.poll()) {
+    g_dirty = true;
+  }
 
   if (g_dirty) {
     display();
@@ -294,8 +1161,273 @@ void do_update() {
   }
 }
 
+// The quad position under the centre of every pixel of a width x height
+// frame drawn with mvp, bottom row first. The projection is orthographic,
+// so the quad plane maps onto the screen by the top left 2x2 of mvp and
+// its translation, and back by their inverse. Returns false when the quad
+// is edge on and covers no pixels.
+bool pixel_grid(const mat4f& mvp, int width, int height, FieldGrid* grid) {
+  float a = mvp.at(0, 0), b = mvp.at(1, 0);
+  float c = mvp.at(0, 1), d = mvp.at(1, 1);
+  float det = a*d - b*c;
+  if (fabsf(det) < 1e-12f) {
+    return false;
+  }
+  // from a change in normalised device coordinates to one on the quad
+  float ia = d / det, ib = -b / det, ic = -c / det, id = a / det;
+  float nx = 1.f / width - 1.f - mvp.at(3, 0);
+  float ny = 1.f / height - 1.f - mvp.at(3, 1);
+  grid->origin[0] = ia * nx + ib * ny;
+  grid->origin[1] = ic * nx + id * ny;
+  grid->x_step[0] = ia * 2.f / width;
+  grid->x_step[1] = ic * 2.f / width;
+  grid->y_step[0] = ib * 2.f / height;
+  grid->y_step[1] = id * 2.f / height;
+  grid->width = width;
+  grid->height = height;
+  return true;
+}
+
+// As run_headless, but without a GPU: misc/field_eval.h evaluates and
+// colours the field of each camera state on the CPU, with the kernel and
+// colormap the per-pixel path would draw with the fixed range, and pixels
+// off the quad keep the clear colour. The HUD is not drawn.
+int run_cpu_render(int width, int height, const char* script, const char* prefix) {
+  std::vector<CameraState> states;
+  if (!load_camera_script(script, &states)) {
+    return 1;
+  }
+  reshape_window(NULL, width, height);
+
+  ThreadPool pool;
+  pool.init(ThreadPool::default_worker_count());
+  const size_t sample_count = (size_t)width * height;
+  std::vector<float> field(sample_count);
+  std::vector<unsigned char> pixels(4 * sample_count);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  bool ok = true;
+  for (size_t i = 0; i < states.size() && ok; ++i) {
+    g_scale = states[i].scale;
+    g_pan = vec2d(states[i].pan);
+    g_orient = states[i].orient;
+
+    FieldGrid grid;
+    bool visible = pixel_grid(view_projection(), width, height, &grid);
+    if (visible) {
+      evaluate_field(g_kernel_type, k_lines, sizeof(k_lines) / (2 * sizeof(float)),
+        grid, &field[0], &pool);
+      colormap_field_rgba8(g_colormap, &field[0], sample_count, 0.f, 1.f,
+        &pixels[0], &pool);
+    }
+    for (size_t y = 0; y < (size_t)height; ++y) {
+      for (size_t x = 0; x < (size_t)width; ++x) {
+        float px = grid.origin[0] + grid.y_step[0] * y + grid.x_step[0] * x;
+        float py = grid.origin[1] + grid.y_step[1] * y + grid.x_step[1] * x;
+        if (!visible || fabsf(px) > 1.f || fabsf(py) > 1.f) {
+          unsigned char* pixel = &pixels[4 * (y * width + x)];
+          pixel[0] = pixel[1] = pixel[2] = 0;
+          pixel[3] = 255;
+        }
+      }
+    }
+
+    TRACE_ZONE("write_frame");
+    char filename[1024];
+    snprintf(filename, sizeof(filename), "%s%05zu.ppm", prefix, i);
+    ok = write_ppm_rgba8(filename, width, height, &pixels[0]);
+  }
+
+  double seconds = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+  printf("Rendered %zu frames of %dx%d on the CPU (%s, %zu threads) in %.3f s "
+    "(%.1f frames/s)\n", states.size(), width, height, field_eval_isa(),
+    pool.thread_count(), seconds, states.size() / seconds);
+  pool.cleanup();
+  write_trace();
+  return ok ? 0 : 1;
+}
+
+#ifdef GRAD_HEADLESS
+// Draws one frame per camera state into an offscreen target of the given
+// size and writes each to <prefix>NNNNN.ppm. Frames are read back through
+// two pixel buffers, so frame n is written out while frame n + 1 renders.
+int run_headless(int width, int height, const char* script, const char* prefix) {
+  std::vector<CameraState> states;
+  if (!load_camera_script(script, &states)) {
+    return 1;
+  }
+
+  HeadlessContext context;
+  if (!context.init(g_gl_debug)) {
+    return 1;
+  }
+  if (g_gl_debug) {
+    gl_debug_install((GLADloadproc)HeadlessContext::get_proc_address);
+  }
+  g_frame_timer.keep_whole_run();
+  init();
+
+  RenderTarget frame;
+  frame.init(GL_RGBA8);
+  frame.set_label("headless frame");
+  frame.resize(width, height);
+  RenderTarget::set_default_framebuffer(frame.framebuffer());
+  reshape_window(NULL, width, height);
+
+  const size_t frame_bytes = 4 * (size_t)width * height;
+  GLuint pixel_buffer_ids[2];
+  glGenBuffers(2, pixel_buffer_ids);
+  for (size_t i = 0; i < 2; ++i) {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_buffer_ids[i]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, frame_bytes, NULL, GL_STREAM_READ);
+    gpu_memory_allocate(GPU_OBJECT_BUFFER, pixel_buffer_ids[i], GPU_MEMORY_READBACK,
+      frame_bytes, "frame readback");
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  bool ok = true;
+  for (size_t i = 0; i <= states.size() && ok; ++i) {
+    if (i < states.size()) {
+      g_scale = states[i].scale;
+      g_pan = vec2d(states[i].pan);
+      g_orient = states[i].orient;
+      g_frame_timer.begin_cpu(TIME_FRAME);
+      g_frame_timer.begin_cpu(TIME_DISPLAY);
+      display();
+      g_frame_timer.end_cpu(TIME_DISPLAY);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_buffer_ids[i % 2]);
+      glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+      g_frame_timer.end_cpu(TIME_FRAME);
+      end_frame();
+    }
+    if (i == 0) {
+      continue;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_buffer_ids[(i - 1) % 2]);
+    const unsigned char* pixels = (const unsigned char*)glMapBufferRange(
+      GL_PIXEL_PACK_BUFFER, 0, frame_bytes, GL_MAP_READ_BIT);
+    if (!pixels) {
+      fprintf(stderr, "Could not map frame %zu\n", i - 1);
+      ok = false;
+      break;
+    }
+    TRACE_ZONE("write_frame");
+    char filename[1024];
+    snprintf(filename, sizeof(filename), "%s%05zu.ppm", prefix, i - 1);
+    ok = write_ppm_rgba8(filename, width, height, pixels);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  double seconds = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+  printf("Rendered %zu frames of %dx%d in %.3f s (%.1f frames/s)\n",
+    states.size(), width, height, seconds, states.size() / seconds);
+  dump_frame_times();
+#ifdef GRAD_GL_PROFILE
+  print_gl_profile();
+#endif
+  gl_debug_print_summary();
+  gpu_memory_print();
+  write_trace();
+
+  for (size_t i = 0; i < 2; ++i) {
+    gpu_memory_release(GPU_OBJECT_BUFFER, pixel_buffer_ids[i]);
+  }
+  glDeleteBuffers(2, pixel_buffer_ids);
+  RenderTarget::set_default_framebuffer(0);
+  frame.cleanup();
+  cleanup();
+  context.cleanup();
+  return ok ? 0 : 1;
+}
+#endif
+
+void print_usage(const char* program) {
+  fprintf(stderr,
+    "usage: %s [--frame-times FILE.csv|FILE.json] [--trace FILE.json] [--hud]\n"
+    "          [--gl-debug] [--record FILE | --replay FILE [--replay-pace frame|original]]\n"
+    "          [--headless WIDTHxHEIGHT SCRIPT OUTPUT_PREFIX]\n"
+    "          [--cpu-render WIDTHxHEIGHT SCRIPT OUTPUT_PREFIX]\n"
+    "          [--cpu-isa auto|avx512|avx2|sse2|neon|scalar]\n",
+    program);
+}
+
 int main(int argc, char** argv) {
-  (void)argc; (void)argv;
+  const char* headless_size = NULL;
+  const char* headless_script = NULL;
+  const char* headless_prefix = NULL;
+  bool cpu_render = false;
+  const char* record_filename = NULL;
+  const char* replay_filename = NULL;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--frame-times") == 0 && i + 1 < argc) {
+      g_frame_times_filename = argv[++i];
+    } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+      g_trace_filename = argv[++i];
+    } else if (strcmp(argv[i], "--hud") == 0) {
+      g_show_hud = true;
+    } else if (strcmp(argv[i], "--gl-debug") == 0) {
+      g_gl_debug = true;
+    } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+      record_filename = argv[++i];
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replay_filename = argv[++i];
+    } else if (strcmp(argv[i], "--replay-pace") == 0 && i + 1 < argc &&
+        (strcmp(argv[i + 1], "frame") == 0 || strcmp(argv[i + 1], "original") == 0)) {
+      g_replay_pace = strcmp(argv[++i], "frame") == 0 ? REPLAY_BY_FRAME : REPLAY_ORIGINAL;
+    } else if (strcmp(argv[i], "--headless") == 0 && i + 3 < argc) {
+      headless_size = argv[++i];
+      headless_script = argv[++i];
+      headless_prefix = argv[++i];
+      cpu_render = false;
+    } else if (strcmp(argv[i], "--cpu-render") == 0 && i + 3 < argc) {
+      headless_size = argv[++i];
+      headless_script = argv[++i];
+      headless_prefix = argv[++i];
+      cpu_render = true;
+    } else if (strcmp(argv[i], "--cpu-isa") == 0 && i + 1 < argc) {
+      if (!force_cpu_isa(argv[++i])) {
+        return 1;
+      }
+    } else {
+      print_usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (headless_size) {
+    int width, height;
+    if (sscanf(headless_size, "%dx%d", &width, &height) != 2 ||
+        width <= 0 || height <= 0) {
+      print_usage(argv[0]);
+      return 1;
+    }
+    if (cpu_render) {
+      return run_cpu_render(width, height, headless_script, headless_prefix);
+    }
+#ifdef GRAD_HEADLESS
+    return run_headless(width, height, headless_script, headless_prefix);
+#else
+    fprintf(stderr, "Built without headless support; configure with GRAD_HEADLESS\n");
+    return 1;
+#endif
+  }
+
+  if (record_filename && replay_filename) {
+    print_usage(argv[0]);
+    exit(1);
+  }
+  if (replay_filename) {
+    if (!g_input_replay.load(replay_filename)) {
+      exit(1);
+    }
+    g_replaying = true;
+    g_frame_timer.keep_whole_run();
+  }
+
   if (!glfwInit()) {
     fprintf(stderr, "GLFW initialization failed\n");
     exit(1);
@@ -305,6 +1437,7 @@ int main(int argc, char** argv) {
   glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
   glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, g_gl_debug ? GL_TRUE : GL_FALSE);
 
   GLFWwindow* window = glfwCreateWindow(g_window_size_x, g_window_size_y,
       "Kelp", NULL, NULL);
@@ -314,36 +1447,92 @@ int main(int argc, char** argv) {
   }
 
   glfwMakeContextCurrent(window);
-  glfwSwapInterval(1);
+  // a replay paced by frame runs as fast as it can, to measure frame times
+  glfwSwapInterval(g_replaying && g_replay_pace == REPLAY_BY_FRAME ? 0 : 1);
 
   if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
     fprintf(stderr, "GLAD initialization failed\n");
     exit(1);
   }
+  if (g_gl_debug) {
+    gl_debug_install((GLADloadproc)glfwGetProcAddress);
+  }
 
-  glfwSetWindowSizeCallback(window, reshape_window);
+  glfwSetWindowSizeCallback(window, input_window_size);
   glfwSetFramebufferSizeCallback(window, reshape_framebuffer);
   glfwSetInputMode(window, GLFW_STICKY_KEYS, GL_TRUE);
   glfwGetFramebufferSize(window, &g_window_size_x, &g_window_size_y);
-  glfwSetKeyCallback(window, key_press);
-  glfwSetCursorPosCallback(window, mouse_move);
-  glfwSetMouseButtonCallback(window, mouse_press);
-  glfwSetScrollCallback(window, mouse_scroll);
+  glfwSetKeyCallback(window, input_key);
+  glfwSetCursorPosCallback(window, input_mouse_move);
+  glfwSetMouseButtonCallback(window, input_mouse_button);
+  glfwSetScrollCallback(window, input_scroll);
 
   init();
 
   reshape_window(window, g_window_size_x, g_window_size_y);
   reshape_framebuffer(window, g_window_size_x, g_window_size_y);
 
+  g_input_start = std::chrono::steady_clock::now();
+  if (record_filename) {
+    if (!g_input_recorder.open(record_filename)) {
+      exit(1);
+    }
+    // the starting size, so that a replay begins from the same window
+    int w, h;
+    glfwGetWindowSize(window, &w, &h);
+    record_input(INPUT_WINDOW_SIZE, w, h, 0, 0, 0, 0);
+  }
+
   while (!glfwWindowShouldClose(window)) {
+    g_frame_timer.begin_cpu(TIME_FRAME);
+    g_frame_timer.begin_cpu(TIME_UPDATE_WORLD);
     update_world();
-    glfwPollEvents();
+    g_frame_timer.end_cpu(TIME_UPDATE_WORLD);
+    g_frame_timer.begin_cpu(TIME_POLL_EVENTS);
+    {
+      TRACE_ZONE("glfwPollEvents");
+      glfwPollEvents();
+      if (g_replaying) {
+        replay_input();
+      }
+    }
+    g_frame_timer.end_cpu(TIME_POLL_EVENTS);
+    if (g_range_reducer.poll()) {
+      TRACE_COUNTER("field_range_max", g_range_reducer.range().max);
+      g_dirty = true;
+    }
 
     if (g_dirty) {
+      g_frame_timer.begin_cpu(TIME_DISPLAY);
       display();
-      glfwSwapBuffers(window);
+      g_frame_timer.end_cpu(TIME_DISPLAY);
+      g_frame_timer.begin_cpu(TIME_SWAP_BUFFERS);
+      {
+        TRACE_ZONE("glfwSwapBuffers");
+        glfwSwapBuffers(window);
+      }
+      g_frame_timer.end_cpu(TIME_SWAP_BUFFERS);
       g_dirty = false;
+      g_frame_timer.end_cpu(TIME_FRAME);
+      end_frame();
+    } else {
+      end_idle_pass();
     }
   }
+
+  g_input_recorder.close();
+  if (g_replaying) {
+    fprintf(stderr, "Replayed %zu input events over %u frames\n",
+      g_input_replay.event_count(), g_input_frame);
+  }
+  if (g_frame_times_filename || g_replaying) {
+    dump_frame_times();
+  }
+#ifdef GRAD_GL_PROFILE
+  print_gl_profile();
+#endif
+  gl_debug_print_summary();
+  write_trace();
+  cleanup();
   return 0;
 }
@@ -0,0 +1,418 @@
+#ifndef FLOATX_H
+#define FLOATX_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "math/vector_math.h"
+
+#if defined(__AVX512F__) && !defined(VECTOR_MATH_NO_SIMD)
+#include <immintrin.h>
+#define FLOATX_AVX512
+#endif
+
+// N float lanes for writing a kernel once and compiling it for several
+// widths. floatx<4> is an SSE register on x86, floatx<8> an AVX register
+// when the compiler targets AVX (GRAD_AVX2 in CMake) and floatx<16> an
+// AVX-512 register with -mavx512f. Where 8 or 16 lanes are wider than the
+// target they are two or four registers. Other widths, every width on
+// other targets and every width under VECTOR_MATH_NO_SIMD are arrays that
+// the compiler vectorises as it can.
+//
+// Comparisons give a maskx<N>, which select() uses to pick lanes from one
+// value or another, and which any() and all() reduce.
+//
+// Everything here and in vec3f_x.h and quaternion_x.h is in namespace simd,
+// where load, min, sqrt and the rest cannot meet the overloads of <cmath>,
+// <algorithm> or the includer. Functions that write memory take the
+// destination first, as store(float*, floatx<N>) does.
+namespace simd {
+  template <size_t N>
+  struct floatx {
+    float v[N];
+  };
+
+  template <size_t N>
+  struct maskx {
+    bool v[N];
+  };
+
+  // splat, load and gather need the width spelled out, as in splat<8>(1.f).
+
+  template <size_t N>
+  inline floatx<N> splat(float x) {
+    floatx<N> r;
+    for (size_t i = 0; i < N; ++i) r.v[i] = x;
+    return r;
+  }
+
+  template <size_t N>
+  inline floatx<N> load(const float* p) {
+    floatx<N> r;
+    for (size_t i = 0; i < N; ++i) r.v[i] = p[i];
+    return r;
+  }
+
+  // base[offsets[i]] in lane i
+  template <size_t N>
+  inline floatx<N> gather(const float* base, const int32_t* offsets) {
+    floatx<N> r;
+    for (size_t i = 0; i < N; ++i) r.v[i] = base[offsets[i]];
+    return r;
+  }
+
+  template <size_t N>
+  inline void store(float* p, floatx<N> a) {
+    for (size_t i = 0; i < N; ++i) p[i] = a.v[i];
+  }
+
+  template <size_t N>
+  inline void scatter(float* base, const int32_t* offsets, floatx<N> a) {
+    for (size_t i = 0; i < N; ++i) base[offsets[i]] = a.v[i];
+  }
+
+#define FLOATX_GENERIC_BINARY(op, expr) \
+    template <size_t N> \
+    inline floatx<N> op(floatx<N> a, floatx<N> b) { \
+      floatx<N> r; \
+      for (size_t i = 0; i < N; ++i) r.v[i] = (expr); \
+      return r; \
+    }
+  FLOATX_GENERIC_BINARY(operator+, a.v[i] + b.v[i])
+  FLOATX_GENERIC_BINARY(operator-, a.v[i] - b.v[i])
+  FLOATX_GENERIC_BINARY(operator*, a.v[i] * b.v[i])
+  FLOATX_GENERIC_BINARY(operator/, a.v[i] / b.v[i])
+  FLOATX_GENERIC_BINARY(min, a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+  FLOATX_GENERIC_BINARY(max, a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+#undef FLOATX_GENERIC_BINARY
+
+#define FLOATX_GENERIC_COMPARE(op) \
+    template <size_t N> \
+    inline maskx<N> operator op(floatx<N> a, floatx<N> b) { \
+      maskx<N> r; \
+      for (size_t i = 0; i < N; ++i) r.v[i] = a.v[i] op b.v[i]; \
+      return r; \
+    }
+  FLOATX_GENERIC_COMPARE(<)
+  FLOATX_GENERIC_COMPARE(<=)
+  FLOATX_GENERIC_COMPARE(>)
+  FLOATX_GENERIC_COMPARE(>=)
+  FLOATX_GENERIC_COMPARE(==)
+#undef FLOATX_GENERIC_COMPARE
+
+  template <size_t N>
+  inline floatx<N> operator-(floatx<N> a) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = -a.v[i];
+    return a;
+  }
+
+  template <size_t N>
+  inline floatx<N> sqrt(floatx<N> a) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = sqrtf(a.v[i]);
+    return a;
+  }
+
+  // to the nearest integer, ties to even, for |a| below 2^31
+  template <size_t N>
+  inline floatx<N> round(floatx<N> a) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = nearbyintf(a.v[i]);
+    return a;
+  }
+
+  // 2^n for integral n in [-126, 127]
+  template <size_t N>
+  inline floatx<N> exp2i(floatx<N> n) {
+    for (size_t i = 0; i < N; ++i) n.v[i] = ldexpf(1.f, (int)n.v[i]);
+    return n;
+  }
+
+  template <size_t N>
+  inline floatx<N> select(maskx<N> m, floatx<N> a, floatx<N> b) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = m.v[i] ? a.v[i] : b.v[i];
+    return a;
+  }
+
+  template <size_t N>
+  inline maskx<N> operator&(maskx<N> a, maskx<N> b) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = a.v[i] && b.v[i];
+    return a;
+  }
+
+  template <size_t N>
+  inline maskx<N> operator|(maskx<N> a, maskx<N> b) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = a.v[i] || b.v[i];
+    return a;
+  }
+
+  template <size_t N>
+  inline maskx<N> operator!(maskx<N> a) {
+    for (size_t i = 0; i < N; ++i) a.v[i] = !a.v[i];
+    return a;
+  }
+
+  template <size_t N>
+  inline bool any(maskx<N> m) {
+    bool r = false;
+    for (size_t i = 0; i < N; ++i) r = r || m.v[i];
+    return r;
+  }
+
+  template <size_t N>
+  inline bool all(maskx<N> m) {
+    bool r = true;
+    for (size_t i = 0; i < N; ++i) r = r && m.v[i];
+    return r;
+  }
+
+#if defined(VECTOR_MATH_SSE)
+  template <> struct floatx<4> { __m128 v; };
+  template <> struct maskx<4> { __m128 v; };
+
+  template <> inline floatx<4> splat<4>(float x) { floatx<4> r = { _mm_set1_ps(x) }; return r; }
+  template <> inline floatx<4> load<4>(const float* p) { floatx<4> r = { _mm_loadu_ps(p) }; return r; }
+  template <> inline floatx<4> gather<4>(const float* base, const int32_t* o) {
+    floatx<4> r = { _mm_setr_ps(base[o[0]], base[o[1]], base[o[2]], base[o[3]]) };
+    return r;
+  }
+  inline void store(float* p, floatx<4> a) { _mm_storeu_ps(p, a.v); }
+  inline void scatter(float* base, const int32_t* o, floatx<4> a) {
+    float lanes[4];
+    store(lanes, a);
+    for (size_t i = 0; i < 4; ++i) base[o[i]] = lanes[i];
+  }
+
+  inline floatx<4> operator+(floatx<4> a, floatx<4> b) { floatx<4> r = { _mm_add_ps(a.v, b.v) }; return r; }
+  inline floatx<4> operator-(floatx<4> a, floatx<4> b) { floatx<4> r = { _mm_sub_ps(a.v, b.v) }; return r; }
+  inline floatx<4> operator*(floatx<4> a, floatx<4> b) { floatx<4> r = { _mm_mul_ps(a.v, b.v) }; return r; }
+  inline floatx<4> operator/(floatx<4> a, floatx<4> b) { floatx<4> r = { _mm_div_ps(a.v, b.v) }; return r; }
+  inline floatx<4> min(floatx<4> a, floatx<4> b) { floatx<4> r = { _mm_min_ps(a.v, b.v) }; return r; }
+  inline floatx<4> max(floatx<4> a, floatx<4> b) { floatx<4> r = { _mm_max_ps(a.v, b.v) }; return r; }
+  inline floatx<4> operator-(floatx<4> a) { floatx<4> r = { _mm_xor_ps(a.v, _mm_set1_ps(-0.f)) }; return r; }
+  inline floatx<4> sqrt(floatx<4> a) { floatx<4> r = { _mm_sqrt_ps(a.v) }; return r; }
+  inline floatx<4> round(floatx<4> a) { floatx<4> r = { _mm_cvtepi32_ps(_mm_cvtps_epi32(a.v)) }; return r; }
+  inline floatx<4> exp2i(floatx<4> n) {
+    __m128i bits = _mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127)), 23);
+    floatx<4> r = { _mm_castsi128_ps(bits) };
+    return r;
+  }
+
+  inline maskx<4> operator<(floatx<4> a, floatx<4> b) { maskx<4> r = { _mm_cmplt_ps(a.v, b.v) }; return r; }
+  inline maskx<4> operator<=(floatx<4> a, floatx<4> b) { maskx<4> r = { _mm_cmple_ps(a.v, b.v) }; return r; }
+  inline maskx<4> operator>(floatx<4> a, floatx<4> b) { maskx<4> r = { _mm_cmpgt_ps(a.v, b.v) }; return r; }
+  inline maskx<4> operator>=(floatx<4> a, floatx<4> b) { maskx<4> r = { _mm_cmpge_ps(a.v, b.v) }; return r; }
+  inline maskx<4> operator==(floatx<4> a, floatx<4> b) { maskx<4> r = { _mm_cmpeq_ps(a.v, b.v) }; return r; }
+  inline floatx<4> select(maskx<4> m, floatx<4> a, floatx<4> b) {
+    floatx<4> r = { _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)) };
+    return r;
+  }
+  inline maskx<4> operator&(maskx<4> a, maskx<4> b) { maskx<4> r = { _mm_and_ps(a.v, b.v) }; return r; }
+  inline maskx<4> operator|(maskx<4> a, maskx<4> b) { maskx<4> r = { _mm_or_ps(a.v, b.v) }; return r; }
+  inline maskx<4> operator!(maskx<4> a) {
+    maskx<4> r = { _mm_xor_ps(a.v, _mm_cmpeq_ps(a.v, a.v)) };
+    return r;
+  }
+  inline bool any(maskx<4> m) { return _mm_movemask_ps(m.v) != 0; }
+  inline bool all(maskx<4> m) { return _mm_movemask_ps(m.v) == 0xf; }
+#endif
+
+#if defined(VECTOR_MATH_AVX)
+  template <> struct floatx<8> { __m256 v; };
+  template <> struct maskx<8> { __m256 v; };
+
+  template <> inline floatx<8> splat<8>(float x) { floatx<8> r = { _mm256_set1_ps(x) }; return r; }
+  template <> inline floatx<8> load<8>(const float* p) { floatx<8> r = { _mm256_loadu_ps(p) }; return r; }
+  template <> inline floatx<8> gather<8>(const float* base, const int32_t* o) {
+#if defined(__AVX2__)
+    floatx<8> r = { _mm256_i32gather_ps(base, _mm256_loadu_si256((const __m256i*)o), 4) };
+#else
+    floatx<8> r = { _mm256_setr_ps(base[o[0]], base[o[1]], base[o[2]], base[o[3]],
+                                   base[o[4]], base[o[5]], base[o[6]], base[o[7]]) };
+#endif
+    return r;
+  }
+  inline void store(float* p, floatx<8> a) { _mm256_storeu_ps(p, a.v); }
+  inline void scatter(float* base, const int32_t* o, floatx<8> a) {
+    float lanes[8];
+    store(lanes, a);
+    for (size_t i = 0; i < 8; ++i) base[o[i]] = lanes[i];
+  }
+
+  inline floatx<8> operator+(floatx<8> a, floatx<8> b) { floatx<8> r = { _mm256_add_ps(a.v, b.v) }; return r; }
+  inline floatx<8> operator-(floatx<8> a, floatx<8> b) { floatx<8> r = { _mm256_sub_ps(a.v, b.v) }; return r; }
+  inline floatx<8> operator*(floatx<8> a, floatx<8> b) { floatx<8> r = { _mm256_mul_ps(a.v, b.v) }; return r; }
+  inline floatx<8> operator/(floatx<8> a, floatx<8> b) { floatx<8> r = { _mm256_div_ps(a.v, b.v) }; return r; }
+  inline floatx<8> min(floatx<8> a, floatx<8> b) { floatx<8> r = { _mm256_min_ps(a.v, b.v) }; return r; }
+  inline floatx<8> max(floatx<8> a, floatx<8> b) { floatx<8> r = { _mm256_max_ps(a.v, b.v) }; return r; }
+  inline floatx<8> operator-(floatx<8> a) { floatx<8> r = { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)) }; return r; }
+  inline floatx<8> sqrt(floatx<8> a) { floatx<8> r = { _mm256_sqrt_ps(a.v) }; return r; }
+  inline floatx<8> round(floatx<8> a) {
+    floatx<8> r = { _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    return r;
+  }
+  inline floatx<8> exp2i(floatx<8> n) {
+#if defined(__AVX2__)
+    __m256i bits = _mm256_slli_epi32(
+      _mm256_add_epi32(_mm256_cvtps_epi32(n.v), _mm256_set1_epi32(127)), 23);
+    floatx<8> r = { _mm256_castsi256_ps(bits) };
+#else
+    floatx<4> lo = { _mm256_castps256_ps128(n.v) };
+    floatx<4> hi = { _mm256_extractf128_ps(n.v, 1) };
+    floatx<8> r = { _mm256_insertf128_ps(_mm256_castps128_ps256(exp2i(lo).v), exp2i(hi).v, 1) };
+#endif
+    return r;
+  }
+
+  inline maskx<8> operator<(floatx<8> a, floatx<8> b) { maskx<8> r = { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; return r; }
+  inline maskx<8> operator<=(floatx<8> a, floatx<8> b) { maskx<8> r = { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; return r; }
+  inline maskx<8> operator>(floatx<8> a, floatx<8> b) { maskx<8> r = { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; return r; }
+  inline maskx<8> operator>=(floatx<8> a, floatx<8> b) { maskx<8> r = { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; return r; }
+  inline maskx<8> operator==(floatx<8> a, floatx<8> b) { maskx<8> r = { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; return r; }
+  inline floatx<8> select(maskx<8> m, floatx<8> a, floatx<8> b) {
+    floatx<8> r = { _mm256_blendv_ps(b.v, a.v, m.v) };
+    return r;
+  }
+  inline maskx<8> operator&(maskx<8> a, maskx<8> b) { maskx<8> r = { _mm256_and_ps(a.v, b.v) }; return r; }
+  inline maskx<8> operator|(maskx<8> a, maskx<8> b) { maskx<8> r = { _mm256_or_ps(a.v, b.v) }; return r; }
+  inline maskx<8> operator!(maskx<8> a) {
+    maskx<8> r = { _mm256_xor_ps(a.v, _mm256_cmp_ps(a.v, a.v, _CMP_TRUE_UQ)) };
+    return r;
+  }
+  inline bool any(maskx<8> m) { return _mm256_movemask_ps(m.v) != 0; }
+  inline bool all(maskx<8> m) { return _mm256_movemask_ps(m.v) == 0xff; }
+#endif
+
+#if defined(FLOATX_AVX512)
+  // Where the plain intrinsic starts from an undefined register, which GCC
+  // warns about, the masked one with every lane set stands in for it.
+  template <> struct floatx<16> { __m512 v; };
+  template <> struct maskx<16> { __mmask16 v; };
+
+  template <> inline floatx<16> splat<16>(float x) { floatx<16> r = { _mm512_set1_ps(x) }; return r; }
+  template <> inline floatx<16> load<16>(const float* p) { floatx<16> r = { _mm512_loadu_ps(p) }; return r; }
+  template <> inline floatx<16> gather<16>(const float* base, const int32_t* o) {
+    floatx<16> r = { _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xffff,
+      _mm512_loadu_si512(o), base, 4) };
+    return r;
+  }
+  inline void store(float* p, floatx<16> a) { _mm512_storeu_ps(p, a.v); }
+  inline void scatter(float* base, const int32_t* o, floatx<16> a) {
+    _mm512_i32scatter_ps(base, _mm512_loadu_si512(o), a.v, 4);
+  }
+
+  inline floatx<16> operator+(floatx<16> a, floatx<16> b) { floatx<16> r = { _mm512_add_ps(a.v, b.v) }; return r; }
+  inline floatx<16> operator-(floatx<16> a, floatx<16> b) { floatx<16> r = { _mm512_sub_ps(a.v, b.v) }; return r; }
+  inline floatx<16> operator*(floatx<16> a, floatx<16> b) { floatx<16> r = { _mm512_mul_ps(a.v, b.v) }; return r; }
+  inline floatx<16> operator/(floatx<16> a, floatx<16> b) { floatx<16> r = { _mm512_div_ps(a.v, b.v) }; return r; }
+  inline floatx<16> min(floatx<16> a, floatx<16> b) { floatx<16> r = { _mm512_mask_min_ps(a.v, 0xffff, a.v, b.v) }; return r; }
+  inline floatx<16> max(floatx<16> a, floatx<16> b) { floatx<16> r = { _mm512_mask_max_ps(a.v, 0xffff, a.v, b.v) }; return r; }
+  inline floatx<16> operator-(floatx<16> a) {
+    floatx<16> r = { _mm512_sub_ps(_mm512_setzero_ps(), a.v) };
+    return r;
+  }
+  inline floatx<16> sqrt(floatx<16> a) { floatx<16> r = { _mm512_mask_sqrt_ps(a.v, 0xffff, a.v) }; return r; }
+  inline floatx<16> round(floatx<16> a) {
+    floatx<16> r = { _mm512_mask_roundscale_ps(a.v, 0xffff, a.v, _MM_FROUND_TO_NEAREST_INT) };
+    return r;
+  }
+  inline floatx<16> exp2i(floatx<16> n) {
+    __m512i bits = _mm512_mask_slli_epi32(_mm512_setzero_si512(), 0xffff, _mm512_add_epi32(
+      _mm512_mask_cvtps_epi32(_mm512_setzero_si512(), 0xffff, n.v), _mm512_set1_epi32(127)), 23);
+    floatx<16> r = { _mm512_castsi512_ps(bits) };
+    return r;
+  }
+
+  inline maskx<16> operator<(floatx<16> a, floatx<16> b) { maskx<16> r = { _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ) }; return r; }
+  inline maskx<16> operator<=(floatx<16> a, floatx<16> b) { maskx<16> r = { _mm512_cmp_ps_mask(a.v, b.v, _CMP_LE_OQ) }; return r; }
+  inline maskx<16> operator>(floatx<16> a, floatx<16> b) { maskx<16> r = { _mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ) }; return r; }
+  inline maskx<16> operator>=(floatx<16> a, floatx<16> b) { maskx<16> r = { _mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ) }; return r; }
+  inline maskx<16> operator==(floatx<16> a, floatx<16> b) { maskx<16> r = { _mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ) }; return r; }
+  inline floatx<16> select(maskx<16> m, floatx<16> a, floatx<16> b) {
+    floatx<16> r = { _mm512_mask_blend_ps(m.v, b.v, a.v) };
+    return r;
+  }
+  inline maskx<16> operator&(maskx<16> a, maskx<16> b) { maskx<16> r = { (__mmask16)(a.v & b.v) }; return r; }
+  inline maskx<16> operator|(maskx<16> a, maskx<16> b) { maskx<16> r = { (__mmask16)(a.v | b.v) }; return r; }
+  inline maskx<16> operator!(maskx<16> a) { maskx<16> r = { (__mmask16)~a.v }; return r; }
+  inline bool any(maskx<16> m) { return m.v != 0; }
+  inline bool all(maskx<16> m) { return m.v == 0xffff; }
+#endif
+
+  // A width above the native one is two of the width below it, so that it
+  // still runs in registers.
+#define FLOATX_SPLIT(N, H) \
+    template <> struct floatx<N> { floatx<H> lo, hi; }; \
+    template <> struct maskx<N> { maskx<H> lo, hi; }; \
+    template <> inline floatx<N> splat<N>(float x) { \
+      floatx<N> r = { splat<H>(x), splat<H>(x) }; \
+      return r; \
+    } \
+    template <> inline floatx<N> load<N>(const float* p) { \
+      floatx<N> r = { load<H>(p), load<H>(p + H) }; \
+      return r; \
+    } \
+    template <> inline floatx<N> gather<N>(const float* base, const int32_t* o) { \
+      floatx<N> r = { gather<H>(base, o), gather<H>(base, o + H) }; \
+      return r; \
+    } \
+    inline void store(float* p, floatx<N> a) { store(p, a.lo); store(p + H, a.hi); } \
+    inline void scatter(float* base, const int32_t* o, floatx<N> a) { \
+      scatter(base, o, a.lo); \
+      scatter(base, o + H, a.hi); \
+    } \
+    FLOATX_SPLIT_BINARY(N, floatx, floatx, operator+, +) \
+    FLOATX_SPLIT_BINARY(N, floatx, floatx, operator-, -) \
+    FLOATX_SPLIT_BINARY(N, floatx, floatx, operator*, *) \
+    FLOATX_SPLIT_BINARY(N, floatx, floatx, operator/, /) \
+    FLOATX_SPLIT_BINARY(N, maskx, floatx, operator<, <) \
+    FLOATX_SPLIT_BINARY(N, maskx, floatx, operator<=, <=) \
+    FLOATX_SPLIT_BINARY(N, maskx, floatx, operator>, >) \
+    FLOATX_SPLIT_BINARY(N, maskx, floatx, operator>=, >=) \
+    FLOATX_SPLIT_BINARY(N, maskx, floatx, operator==, ==) \
+    FLOATX_SPLIT_BINARY(N, maskx, maskx, operator&, &) \
+    FLOATX_SPLIT_BINARY(N, maskx, maskx, operator|, |) \
+    inline floatx<N> min(floatx<N> a, floatx<N> b) { \
+      floatx<N> r = { min(a.lo, b.lo), min(a.hi, b.hi) }; \
+      return r; \
+    } \
+    inline floatx<N> max(floatx<N> a, floatx<N> b) { \
+      floatx<N> r = { max(a.lo, b.lo), max(a.hi, b.hi) }; \
+      return r; \
+    } \
+    inline floatx<N> operator-(floatx<N> a) { floatx<N> r = { -a.lo, -a.hi }; return r; } \
+    inline floatx<N> sqrt(floatx<N> a) { floatx<N> r = { sqrt(a.lo), sqrt(a.hi) }; return r; } \
+    inline floatx<N> round(floatx<N> a) { floatx<N> r = { round(a.lo), round(a.hi) }; return r; } \
+    inline floatx<N> exp2i(floatx<N> a) { floatx<N> r = { exp2i(a.lo), exp2i(a.hi) }; return r; } \
+    inline maskx<N> operator!(maskx<N> a) { maskx<N> r = { !a.lo, !a.hi }; return r; } \
+    inline floatx<N> select(maskx<N> m, floatx<N> a, floatx<N> b) { \
+      floatx<N> r = { select(m.lo, a.lo, b.lo), select(m.hi, a.hi, b.hi) }; \
+      return r; \
+    } \
+    inline bool any(maskx<N> m) { return any(m.lo) || any(m.hi); } \
+    inline bool all(maskx<N> m) { return all(m.lo) && all(m.hi); }
+
+#define FLOATX_SPLIT_BINARY(N, result, operand, name, op) \
+    inline result<N> name(operand<N> a, operand<N> b) { \
+      result<N> r = { a.lo op b.lo, a.hi op b.hi }; \
+      return r; \
+    }
+
+#if defined(VECTOR_MATH_SSE) && !defined(VECTOR_MATH_AVX)
+  FLOATX_SPLIT(8, 4)
+#endif
+#if defined(VECTOR_MATH_SSE) && !defined(FLOATX_AVX512)
+  FLOATX_SPLIT(16, 8)
+#endif
+
+#undef FLOATX_SPLIT_BINARY
+#undef FLOATX_SPLIT
+
+  // Lanes that are not native go through memory.
+  template <size_t N>
+  inline float lane(floatx<N> a, size_t i) {
+    float lanes[N];
+    store(lanes, a);
+    return lanes[i];
+  }
+}
+
+#endif
@@ -7,28 +7,29 @@
 #include "math/vector_math.h"
 
 struct mat3f : public std::array<float, 9> {
-  mat3f();
+  constexpr mat3f();
   template <class... T>
-  mat3f(T... init);
+  constexpr mat3f(T... init);
 
-  operator float*();
-  operator const float*() const;
+  constexpr operator float*();
+  constexpr operator const float*() const;
 };
 
-inline mat3f::mat3f() {
-}
+constexpr mat3f::mat3f()
+  : std::array<float, 9>()
+{}
 
 template <class... T>
-inline mat3f::mat3f(T... init)
+constexpr mat3f::mat3f(T... init)
   : std::array<float, 9>({init...})
 {
 }
 
-inline mat3f::operator float*() {
+constexpr mat3f::operator float*() {
   return this->data();
 }
 
-inline mat3f::operator const float*() const {
+constexpr mat3f::operator const float*() const {
   return this->data();
 }
 
@@ -5,124 +5,225 @@
 #include "math/vector_math.h"
 #include "math/vec4f.h"
 
-struct mat4f {
-  mat4f();
-  mat4f(float a, float b, float c, float d,
-        float e, float f, float g, float h,
-        float i, float j, float k, float l,
-        float m, float n, float o, float p);
-
-  operator float*();
-  operator const float*() const;
-
-  static mat4f identity();
-  static mat4f ortho();
-  static mat4f proj(float r);
-  static mat4f trans(const vec3f& t);
-  static mat4f scale(const vec3f& s);
-  static mat4f rotx(float rx);
-  static mat4f roty(float ry);
-  static mat4f rotz(float rz);
-
-  mat4f& operator*=(const mat4f& rhs);
-  float& at(unsigned x, unsigned y);
-  const float& at(unsigned x, unsigned y) const;
+// 16-byte aligned so that rows load straight into SIMD registers
+struct alignas(16) mat4f {
+  constexpr mat4f();
+  constexpr mat4f(float a, float b, float c, float d,
+                  float e, float f, float g, float h,
+                  float i, float j, float k, float l,
+                  float m, float n, float o, float p);
+
+  constexpr operator float*();
+  constexpr operator const float*() const;
+
+  static constexpr mat4f identity();
+  static constexpr mat4f ortho();
+  static constexpr mat4f proj(float r);
+  static constexpr mat4f trans(const vec3f& t);
+  static constexpr mat4f scale(const vec3f& s);
+  static constexpr mat4f rotx(float rx);
+  static constexpr mat4f roty(float ry);
+  static constexpr mat4f rotz(float rz);
+
+  constexpr mat4f& operator*=(const mat4f& rhs);
+  constexpr float& at(unsigned x, unsigned y);
+  constexpr const float& at(unsigned x, unsigned y) const;
 
   std::array<float, 16> data;
 };
 
-inline mat4f::mat4f() {
-}
+// Zeroed, as constant expressions need; the products that fill a fresh
+// mat4f make the zeroing a dead store.
+constexpr mat4f::mat4f()
+  : data()
+{}
 
-inline mat4f::mat4f(
+// Built a row at a time, so that SIMD code reading the rows back can take
+// them straight from the stores. The element-wise initialisation is for
+// constant expressions, and at run time the row stores replace it.
+constexpr mat4f::mat4f(
   float a, float b, float c, float d,
   float e, float f, float g, float h,
   float i, float j, float k, float l,
   float m, float n, float o, float p)
-  : data({a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p})
+  : data{{a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p}}
 {
+#if defined(VECTOR_MATH_SSE)
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    _mm_store_ps(&data[0], _mm_setr_ps(a, b, c, d));
+    _mm_store_ps(&data[4], _mm_setr_ps(e, f, g, h));
+    _mm_store_ps(&data[8], _mm_setr_ps(i, j, k, l));
+    _mm_store_ps(&data[12], _mm_setr_ps(m, n, o, p));
+  }
+#endif
 }
 
-inline mat4f::operator float*() {
+constexpr mat4f::operator float*() {
   return data.data();
 }
 
-inline mat4f::operator const float*() const {
+constexpr mat4f::operator const float*() const {
   return data.data();
 }
 
-inline mat4f operator*(const mat4f& lhs, const mat4f& rhs) {
+// The product of mat4fs, which is worked out when it is converted to a
+// mat4f. Row i of a * b * c is (row i of a) * b * c, so a chain of products
+// passes each row along in a register rather than storing a matrix per
+// operator. Only the left operand can be a product: one on the right is
+// worked out first, as it would otherwise be repeated for every row.
+//
+// It holds references to its operands, so it must be converted within the
+// expression that made it; assign it to a mat4f rather than to an auto.
+template <class L>
+struct mat4f_product {
+  constexpr operator mat4f() const;
+
+  const L& lhs;
+  const mat4f& rhs;
+};
+
+constexpr mat4f_product<mat4f> operator*(const mat4f& lhs, const mat4f& rhs) {
+  return mat4f_product<mat4f>{lhs, rhs};
+}
+
+template <class L>
+constexpr mat4f_product<mat4f_product<L> > operator*(
+  const mat4f_product<L>& lhs, const mat4f& rhs)
+{
+  return mat4f_product<mat4f_product<L> >{lhs, rhs};
+}
+
+template <class R>
+constexpr mat4f operator*(const mat4f& lhs, const mat4f_product<R>& rhs) {
+  mat4f right = rhs;
+  return lhs * right;
+}
+
+template <class L, class R>
+constexpr mat4f operator*(const mat4f_product<L>& lhs, const mat4f_product<R>& rhs) {
+  mat4f right = rhs;
+  return lhs * right;
+}
+
+// A single product is a whole matrix at a time, which suits the AVX
+// version of m4f_mul_m4fo.
+inline void mat4f_product_store(const mat4f_product<mat4f>& product, float* result) {
+  m4f_mul_m4fo(product.lhs, product.rhs, result);
+}
+
+#if defined(VECTOR_MATH_ROWS)
+inline m4f_row mat4f_product_row(const mat4f& m, size_t i) {
+  return m4f_load_row(m, i);
+}
+
+template <class L>
+inline m4f_row mat4f_product_row(const mat4f_product<L>& product, size_t i) {
+  return m4f_row_mul_m4f(mat4f_product_row(product.lhs, i), product.rhs);
+}
+#endif
+
+template <class L>
+inline void mat4f_product_store(const mat4f_product<mat4f_product<L> >& product,
+                                float* result) {
+#if defined(VECTOR_MATH_ROWS)
+  for (size_t i = 0; i < 4; ++i) {
+    m4f_store_row(mat4f_product_row(product, i), result, i);
+  }
+#else
+  mat4f lhs = product.lhs;
+  m4f_mul_m4fo(lhs, product.rhs, result);
+#endif
+}
+
+template <class L>
+constexpr mat4f_product<L>::operator mat4f() const {
   mat4f result;
-  m4f_mul_m4fo(lhs, rhs, result);
+  if (VECTOR_MATH_CONSTANT_EVALUATED()) {
+    mat4f left = lhs;
+    m4f_mul_m4fo_scalar(left, rhs, result);
+  } else {
+    mat4f_product_store(*this, result);
+  }
   return result;
 }
 
-inline mat4f& mat4f::operator*=(const mat4f& rhs) {
+constexpr mat4f& mat4f::operator*=(const mat4f& rhs) {
   mat4f result = *this * rhs;
   *this = result;
   return *this;
 }
 
-inline mat4f mat4f::identity() {
+constexpr mat4f mat4f::identity() {
   return mat4f(1, 0, 0, 0,
                0, 1, 0, 0,
                0, 0, 1, 0,
                0, 0, 0, 1);
 }
 
-inline mat4f mat4f::ortho() {
+constexpr mat4f mat4f::ortho() {
   return mat4f(1, 0, 0, 0,
                0, 1, 0, 0,
                0, 0, 0, 0,
                0, 0, 0, 1);
 }
 
-inline mat4f mat4f::proj(float r) {
+constexpr mat4f mat4f::proj(float r) {
   return mat4f(1, 0, 0,     0,
                0, 1, 0,     0,
                0, 0, 1,     0,
                0, 0, 1.f/r, 1);
 }
 
-inline mat4f mat4f::trans(const vec3f& t) {
-  mat4f m;
-  m4f_fill_trans_m4fo(t[0], t[1], t[2], m);
-  return m;
+constexpr mat4f mat4f::trans(const vec3f& t) {
+  return mat4f(1, 0, 0, t[0],
+               0, 1, 0, t[1],
+               0, 0, 1, t[2],
+               0, 0, 0, 1);
 }
 
-inline mat4f mat4f::scale(const vec3f& s) {
-  mat4f m;
-  m4f_fill_scale_m4fo(s[0], s[1], s[2], m);
-  return m;
+constexpr mat4f mat4f::scale(const vec3f& s) {
+  return mat4f(s[0], 0,    0,    0,
+               0,    s[1], 0,    0,
+               0,    0,    s[2], 0,
+               0,    0,    0,    1);
 }
 
-inline mat4f mat4f::rotx(float rx) {
-  mat4f m;
-  m4f_fill_rotx_m4fo(rx, m);
-  return m;
+constexpr mat4f mat4f::rotx(float rx) {
+  float c = vector_math_cosf(rx);
+  float s = vector_math_sinf(rx);
+  return mat4f(1, 0,  0, 0,
+               0, c, -s, 0,
+               0, s,  c, 0,
+               0, 0,  0, 1);
 }
 
-inline mat4f mat4f::roty(float ry) {
-  mat4f m;
-  m4f_fill_roty_m4fo(ry, m);
-  return m;
+constexpr mat4f mat4f::roty(float ry) {
+  float c = vector_math_cosf(ry);
+  float s = vector_math_sinf(ry);
+  return mat4f( c, 0, s, 0,
+                0, 1, 0, 0,
+               -s, 0, c, 0,
+                0, 0, 0, 1);
 }
 
-inline mat4f mat4f::rotz(float rz) {
-  mat4f m;
-  m4f_fill_rotz_m4fo(rz, m);
-  return m;
+constexpr mat4f mat4f::rotz(float rz) {
+  float c = vector_math_cosf(rz);
+  float s = vector_math_sinf(rz);
+  return mat4f(c, -s, 0, 0,
+               s,  c, 0, 0,
+               0,  0, 1, 0,
+               0,  0, 0, 1);
 }
 
-inline float& mat4f::at(unsigned x, unsigned y) {
+constexpr float& mat4f::at(unsigned x, unsigned y) {
   return data[4*y + x];
 }
 
-inline const float& mat4f::at(unsigned x, unsigned y) const {
+constexpr const float& mat4f::at(unsigned x, unsigned y) const {
   return data[4*y + x];
 }
 
-inline mat4f transpose(const mat4f& t) {
+constexpr mat4f transpose(const mat4f& t) {
   mat4f m;
   for (unsigned int i = 0; i < 4u; ++i) {
     for (unsigned int j = 0; j < 4u; ++j) {
@@ -132,12 +233,12 @@ inline mat4f transpose(const mat4f& t) {
   return m;
 }
 
-inline vec4f operator*(const mat4f& m, const vec4f& v) {
-  vec4f r{0,0,0,0};
-  for (unsigned int i = 0; i < 4u; ++i) {
-    for (unsigned int j = 0; j < 4u; ++j) {
-      r[i] += m.at(j, i) * v[j];
-    }
+constexpr vec4f operator*(const mat4f& m, const vec4f& v) {
+  vec4f r{};
+  if (VECTOR_MATH_CONSTANT_EVALUATED()) {
+    m4f_mul_v4fo_scalar(m, v.data(), r.data());
+  } else {
+    m4f_mul_v4fo(m, v.data(), r.data());
   }
   return r;
 }
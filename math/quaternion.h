@@ -7,33 +7,33 @@
 
 struct quaternion {
   quaternion() = default;
-  quaternion(float s, const vec3f& v);
+  constexpr quaternion(float s, const vec3f& v);
 
-  quaternion& operator*=(const quaternion& q);
-  mat4f to_mat4f() const;
+  constexpr quaternion& operator*=(const quaternion& q);
+  constexpr mat4f to_mat4f() const;
 
-  static quaternion pure(const vec3f& v);
-  static quaternion rotation(float angle, const vec3f& axis);
+  static constexpr quaternion pure(const vec3f& v);
+  static constexpr quaternion rotation(float angle, const vec3f& axis);
 
   float s;
   vec3f v;
 };
 
-inline quaternion::quaternion(float s, const vec3f& v) {
-  this->s = s;
-  this->v = v;
-}
+constexpr quaternion::quaternion(float s, const vec3f& v)
+  : s(s)
+  , v(v)
+{}
 
-inline quaternion operator*(const quaternion& l, const quaternion& r) {
+constexpr quaternion operator*(const quaternion& l, const quaternion& r) {
   return quaternion(l.s*r.s - dot(l.v, r.v), l.s*r.v + r.s*l.v + cross(l.v, r.v));
 }
 
-inline quaternion& quaternion::operator*=(const quaternion& q) {
+constexpr quaternion& quaternion::operator*=(const quaternion& q) {
   *this = *this * q;
   return *this;
 }
 
-inline mat4f quaternion::to_mat4f() const {
+constexpr mat4f quaternion::to_mat4f() const {
   // http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToMatrix/
   return mat4f(1 - 2*v.y()*v.y() - 2*v.z()*v.z(),
                 2*v.x()*v.y() - 2*v.z()*s,
@@ -50,27 +50,71 @@ inline mat4f quaternion::to_mat4f() const {
                0, 0, 0, 1);
 }
 
-inline quaternion conjugate(const quaternion& x) {
+constexpr quaternion conjugate(const quaternion& x) {
   return quaternion(x.s, -x.v);
 }
 
-inline quaternion quaternion::pure(const vec3f& v) {
+constexpr quaternion operator+(const quaternion& lhs, const quaternion& rhs) {
+  return quaternion(lhs.s + rhs.s, lhs.v + rhs.v);
+}
+
+constexpr quaternion operator*(float lhs, const quaternion& rhs) {
+  return quaternion(lhs * rhs.s, lhs * rhs.v);
+}
+
+constexpr float dot(const quaternion& a, const quaternion& b) {
+  return a.s*b.s + dot(a.v, b.v);
+}
+
+// Products of unit quaternions drift from unit length as their rounding
+// errors add up, so orientations that are multiplied again and again need
+// renormalising. Zero quaternions stay zero.
+constexpr quaternion normalized(const quaternion& q) {
+  float length_sq = dot(q, q);
+  return length_sq > 0 ? (1.f / vector_math_sqrtf(length_sq)) * q : q;
+}
+
+// Interpolation between rotations takes the short way round: q and -q are
+// the same rotation, and of the two the one nearer from is used.
+constexpr quaternion nlerp(const quaternion& from, const quaternion& to, float t) {
+  float sign = dot(from, to) < 0 ? -1.f : 1.f;
+  return normalized((1 - t) * from + (t * sign) * to);
+}
+
+// Above this cosine between from and to, slerp gives way to nlerp, which is
+// then as accurate and does not lose precision to the tiny angle.
+constexpr float k_slerp_nlerp_cosine = 0.9995f;
+
+// Normalising the sum of from and to weighted by sin((1 - t) theta) and
+// sin(t theta) does the work of dividing by sin(theta).
+inline quaternion slerp(const quaternion& from, const quaternion& to, float t) {
+  float cosine = dot(from, to);
+  float sign = cosine < 0 ? -1.f : 1.f;
+  cosine *= sign;
+  if (cosine > k_slerp_nlerp_cosine) {
+    return nlerp(from, to, t);
+  }
+  float theta = acosf(cosine);
+  return normalized(sinf((1 - t) * theta) * from + (sign * sinf(t * theta)) * to);
+}
+
+constexpr quaternion quaternion::pure(const vec3f& v) {
   return quaternion(0, v);
 }
 
-inline quaternion quaternion::rotation(float angle, const vec3f& axis) {
+constexpr quaternion quaternion::rotation(float angle, const vec3f& axis) {
   float half_angle = angle / 2.f;
-  return quaternion(cosf(half_angle), axis*sinf(half_angle));
+  return quaternion(vector_math_cosf(half_angle), axis*vector_math_sinf(half_angle));
 }
 
-inline vec3f qrotate(const vec3f& point, const vec3f& axis, float angle) {
+constexpr vec3f qrotate(const vec3f& point, const vec3f& axis, float angle) {
   quaternion q = quaternion::rotation(angle, axis);
   quaternion p = quaternion::pure(point);
   quaternion r = q * p * conjugate(q);
   return r.v;
 }
 
-inline vec3f qrotate(const vec3f& point, const quaternion& q) {
+constexpr vec3f qrotate(const vec3f& point, const quaternion& q) {
   quaternion p = quaternion::pure(point);
   quaternion r = q * p * conjugate(q);
   return r.v;
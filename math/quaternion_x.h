@@ -0,0 +1,263 @@
+#ifndef QUATERNION_X_H
+#define QUATERNION_X_H
+
+#include <stddef.h>
+#include "math/floatx.h"
+#include "math/mat4f.h"
+#include "math/quaternion.h"
+#include "math/vec3f_x.h"
+
+// N quaternions held as s, x, y and z lanes (see floatx.h and vec3f_x.h),
+// with the quaternion operations applied to every lane at once, for the
+// batch routines of misc/quaternion_batch.h.
+//
+// load and store move N consecutive quaternions; store_mat4f writes N
+// consecutive matrices.
+namespace simd {
+  template <size_t N>
+  struct quaternionx {
+    quaternionx() = default;
+    quaternionx(floatx<N> s, const vec3fx<N>& v);
+
+    floatx<N> s;
+    vec3fx<N> v;
+  };
+
+  typedef quaternionx<4> quaternion_x4;
+  typedef quaternionx<8> quaternion_x8;
+
+  template <size_t N>
+  inline quaternionx<N>::quaternionx(floatx<N> s, const vec3fx<N>& v)
+    : s(s)
+    , v(v)
+  {}
+
+  template <size_t N>
+  inline quaternionx<N> operator*(const quaternionx<N>& l, const quaternionx<N>& r) {
+    return quaternionx<N>(l.s*r.s - dot(l.v, r.v), l.s*r.v + r.s*l.v + cross(l.v, r.v));
+  }
+
+  template <size_t N>
+  inline floatx<N> dot(const quaternionx<N>& a, const quaternionx<N>& b) {
+    return a.s*b.s + dot(a.v, b.v);
+  }
+
+  template <size_t N>
+  inline quaternionx<N> operator*(floatx<N> lhs, const quaternionx<N>& rhs) {
+    return quaternionx<N>(lhs * rhs.s, lhs * rhs.v);
+  }
+
+  template <size_t N>
+  inline quaternionx<N> operator+(const quaternionx<N>& lhs, const quaternionx<N>& rhs) {
+    return quaternionx<N>(lhs.s + rhs.s, lhs.v + rhs.v);
+  }
+
+  // Zero quaternions stay zero, as with normalized(quaternion).
+  template <size_t N>
+  inline quaternionx<N> normalized(const quaternionx<N>& q) {
+    floatx<N> length_sq = dot(q, q);
+    floatx<N> scale = select(length_sq > splat<N>(0.f),
+      splat<N>(1.f) / sqrt(length_sq), splat<N>(1.f));
+    return scale * q;
+  }
+
+  // to with its sign flipped in the lanes where it is more than a half turn
+  // from from, so that interpolation takes the short way round; *cosine gets
+  // the cosine of the angle between them, which is then at least zero.
+  template <size_t N>
+  inline quaternionx<N> nearest(const quaternionx<N>& from, const quaternionx<N>& to,
+                                floatx<N>* cosine) {
+    floatx<N> d = dot(from, to);
+    floatx<N> sign = select(d < splat<N>(0.f), splat<N>(-1.f), splat<N>(1.f));
+    *cosine = sign * d;
+    return sign * to;
+  }
+
+  template <size_t N>
+  inline quaternionx<N> nlerp(const quaternionx<N>& from, const quaternionx<N>& to,
+                              floatx<N> t) {
+    floatx<N> cosine;
+    quaternionx<N> near_to = nearest(from, to, &cosine);
+    return normalized((splat<N>(1.f) - t) * from + t * near_to);
+  }
+
+  // acos(x) for x in [0, 1], within 5e-7 radians: Abramowitz and Stegun
+  // 4.4.46.
+  template <size_t N>
+  inline floatx<N> acos_unit(floatx<N> x) {
+    floatx<N> p = splat<N>(-0.0012624911f);
+    p = p * x + splat<N>(0.0066700901f);
+    p = p * x + splat<N>(-0.0170881256f);
+    p = p * x + splat<N>(0.0308918810f);
+    p = p * x + splat<N>(-0.0501743046f);
+    p = p * x + splat<N>(0.0889789874f);
+    p = p * x + splat<N>(-0.2145988016f);
+    p = p * x + splat<N>(1.5707963050f);
+    return sqrt(max(splat<N>(1.f) - x, splat<N>(0.f))) * p;
+  }
+
+  // sin(x) for x in [0, pi/2], within 1e-7: the Taylor series to x^11.
+  template <size_t N>
+  inline floatx<N> sin_quadrant(floatx<N> x) {
+    floatx<N> x2 = x * x;
+    floatx<N> p = splat<N>(-1.f / 39916800.f);
+    p = p * x2 + splat<N>(1.f / 362880.f);
+    p = p * x2 + splat<N>(-1.f / 5040.f);
+    p = p * x2 + splat<N>(1.f / 120.f);
+    p = p * x2 + splat<N>(-1.f / 6.f);
+    p = p * x2 + splat<N>(1.f);
+    return p * x;
+  }
+
+  // The weights sin((1 - t) theta) and sin(t theta) give the direction of the
+  // slerp, and normalising takes the place of dividing by sin(theta). Lanes
+  // where from and to are close enough for that to lose precision nlerp.
+  template <size_t N>
+  inline quaternionx<N> slerp(const quaternionx<N>& from, const quaternionx<N>& to,
+                              floatx<N> t) {
+    floatx<N> cosine;
+    quaternionx<N> near_to = nearest(from, to, &cosine);
+    floatx<N> theta = acos_unit(min(cosine, splat<N>(1.f)));
+    floatx<N> from_weight = sin_quadrant((splat<N>(1.f) - t) * theta);
+    floatx<N> to_weight = sin_quadrant(t * theta);
+    maskx<N> close = cosine > splat<N>(k_slerp_nlerp_cosine);
+    from_weight = select(close, splat<N>(1.f) - t, from_weight);
+    to_weight = select(close, t, to_weight);
+    return normalized(from_weight * from + to_weight * near_to);
+  }
+
+  // N groups of four floats, each stride floats after the one before, into
+  // and out of four floatx<N>: lane i of rows[k] is element k of group i.
+  template <size_t N>
+  inline void load_transposed4(const float* p, size_t stride, floatx<N>* rows) {
+    float lanes[4][N];
+    for (size_t i = 0; i < N; ++i) {
+      for (size_t k = 0; k < 4; ++k) {
+        lanes[k][i] = p[stride*i + k];
+      }
+    }
+    for (size_t k = 0; k < 4; ++k) {
+      rows[k] = load<N>(lanes[k]);
+    }
+  }
+
+  template <size_t N>
+  inline void store_transposed4(float* p, size_t stride, const floatx<N>* rows) {
+    float lanes[4][N];
+    for (size_t k = 0; k < 4; ++k) {
+      store(lanes[k], rows[k]);
+    }
+    for (size_t i = 0; i < N; ++i) {
+      for (size_t k = 0; k < 4; ++k) {
+        p[stride*i + k] = lanes[k][i];
+      }
+    }
+  }
+
+#if defined(VECTOR_MATH_SSE)
+  // A 4x4 transpose in registers, where the copies through memory above
+  // cost more than the quaternion arithmetic itself.
+  template <>
+  inline void load_transposed4<4>(const float* p, size_t stride, floatx<4>* rows) {
+    __m128 a = _mm_loadu_ps(p);
+    __m128 b = _mm_loadu_ps(p + stride);
+    __m128 c = _mm_loadu_ps(p + 2*stride);
+    __m128 d = _mm_loadu_ps(p + 3*stride);
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    rows[0].v = a;
+    rows[1].v = b;
+    rows[2].v = c;
+    rows[3].v = d;
+  }
+
+  template <>
+  inline void store_transposed4<4>(float* p, size_t stride, const floatx<4>* rows) {
+    __m128 a = rows[0].v, b = rows[1].v, c = rows[2].v, d = rows[3].v;
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    _mm_storeu_ps(p, a);
+    _mm_storeu_ps(p + stride, b);
+    _mm_storeu_ps(p + 2*stride, c);
+    _mm_storeu_ps(p + 3*stride, d);
+  }
+#endif
+
+#if defined(VECTOR_MATH_AVX)
+  // The same on groups i and i + 4 at once, one in each 128-bit half.
+  inline void transpose4_halves(__m256* a, __m256* b, __m256* c, __m256* d) {
+    __m256 ab_lo = _mm256_unpacklo_ps(*a, *b);
+    __m256 cd_lo = _mm256_unpacklo_ps(*c, *d);
+    __m256 ab_hi = _mm256_unpackhi_ps(*a, *b);
+    __m256 cd_hi = _mm256_unpackhi_ps(*c, *d);
+    *a = _mm256_shuffle_ps(ab_lo, cd_lo, _MM_SHUFFLE(1, 0, 1, 0));
+    *b = _mm256_shuffle_ps(ab_lo, cd_lo, _MM_SHUFFLE(3, 2, 3, 2));
+    *c = _mm256_shuffle_ps(ab_hi, cd_hi, _MM_SHUFFLE(1, 0, 1, 0));
+    *d = _mm256_shuffle_ps(ab_hi, cd_hi, _MM_SHUFFLE(3, 2, 3, 2));
+  }
+
+  inline __m256 load_halves(const float* lo, const float* hi) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+  }
+
+  inline void store_halves(float* lo, float* hi, __m256 a) {
+    _mm_storeu_ps(lo, _mm256_castps256_ps128(a));
+    _mm_storeu_ps(hi, _mm256_extractf128_ps(a, 1));
+  }
+
+  template <>
+  inline void load_transposed4<8>(const float* p, size_t stride, floatx<8>* rows) {
+    __m256 a = load_halves(p, p + 4*stride);
+    __m256 b = load_halves(p + stride, p + 5*stride);
+    __m256 c = load_halves(p + 2*stride, p + 6*stride);
+    __m256 d = load_halves(p + 3*stride, p + 7*stride);
+    transpose4_halves(&a, &b, &c, &d);
+    rows[0].v = a;
+    rows[1].v = b;
+    rows[2].v = c;
+    rows[3].v = d;
+  }
+
+  template <>
+  inline void store_transposed4<8>(float* p, size_t stride, const floatx<8>* rows) {
+    __m256 a = rows[0].v, b = rows[1].v, c = rows[2].v, d = rows[3].v;
+    transpose4_halves(&a, &b, &c, &d);
+    store_halves(p, p + 4*stride, a);
+    store_halves(p + stride, p + 5*stride, b);
+    store_halves(p + 2*stride, p + 6*stride, c);
+    store_halves(p + 3*stride, p + 7*stride, d);
+  }
+#endif
+
+  template <size_t N>
+  inline quaternionx<N> load(const quaternion* q) {
+    floatx<N> rows[4];
+    load_transposed4<N>(&q->s, 4, rows);
+    return quaternionx<N>(rows[0], vec3fx<N>(rows[1], rows[2], rows[3]));
+  }
+
+  template <size_t N>
+  inline void store(quaternion* p, const quaternionx<N>& q) {
+    floatx<N> rows[4] = { q.s, q.v.x, q.v.y, q.v.z };
+    store_transposed4<N>(&p->s, 4, rows);
+  }
+
+  // quaternion::to_mat4f of every lane into N consecutive matrices, written
+  // a row of every matrix at a time
+  template <size_t N>
+  inline void store_mat4f(mat4f* out, const quaternionx<N>& q) {
+    floatx<N> zero = splat<N>(0.f);
+    floatx<N> one = splat<N>(1.f);
+    floatx<N> two = splat<N>(2.f);
+    floatx<N> x = q.v.x, y = q.v.y, z = q.v.z, s = q.s;
+    floatx<N> rows[4][4] = {
+      { one - two*y*y - two*z*z, two*x*y - two*z*s, two*x*z + two*y*s, zero },
+      { two*x*y + two*z*s, one - two*x*x - two*z*z, two*y*z - two*x*s, zero },
+      { two*x*z - two*y*s, two*y*z + two*x*s, one - two*x*x - two*y*y, zero },
+      { zero, zero, zero, one },
+    };
+    for (size_t r = 0; r < 4; ++r) {
+      store_transposed4<N>(&out->data[4*r], 16, rows[r]);
+    }
+  }
+}
+
+#endif
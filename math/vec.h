@@ -0,0 +1,395 @@
+#ifndef VEC_H
+#define VEC_H
+
+#include <stddef.h>
+#include <array>
+#include <type_traits>
+#include "math/vector_math.h"
+
+#if defined(VECTOR_MATH_SSE) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define VEC_SSE2
+#endif
+
+// N components of type T, with the operators of vec2f, vec3f and vec4f,
+// which are its float instances (see vec2f.h, vec3f.h and vec4f.h). The
+// double instances vec2d, vec3d and vec4d are for sums that float would
+// round away, such as bounding boxes of large scenes and deep-zoom pan
+// offsets.
+//
+// The component-wise arithmetic of float x 4 and double x 2 and x 4 runs
+// in SSE, AVX or NEON registers (see vec_simd below), and falls back to
+// plain loops in constant expressions, as mat4f does. Those three are
+// aligned to their size so that they load as whole registers; the others
+// keep the alignment of T, so vec2f and vec3f pack as tightly as before.
+template <typename T, size_t N>
+constexpr size_t vec_alignment() {
+  return (N == 4 && sizeof(T) == 4) || ((N == 2 || N == 4) && sizeof(T) == 8)
+    ? N * sizeof(T) : alignof(T);
+}
+
+template <typename T, size_t N>
+struct alignas(vec_alignment<T, N>()) vec {
+  typedef T value_type;
+
+  vec() = default;
+  // one value per component, as in vec3f(x, y, z) or vec3f{0, 0, 1}
+  template <typename... Ts, typename = typename std::enable_if<
+    sizeof...(Ts) == N && (std::is_arithmetic<Ts>::value && ...)>::type>
+  constexpr vec(Ts... components);
+  // head's components, then last, as in vec4f(v, 1)
+  constexpr vec(const vec<T, N - 1>& head, T last);
+  // from another type of component, rounding as T(x) does
+  template <typename U>
+  explicit constexpr vec(const vec<U, N>& other);
+
+  constexpr T x() const;
+  constexpr T y() const;
+  constexpr T z() const;
+  constexpr T w() const;
+  constexpr vec<T, 3> xyz() const;
+
+  constexpr const T* data() const;
+  constexpr T* data();
+
+  constexpr const T& operator[](size_t i) const;
+  constexpr T& operator[](size_t i);
+
+  constexpr vec& operator+=(const vec& rhs);
+  constexpr vec& operator-=(const vec& rhs);
+  constexpr vec& operator*=(T rhs);
+  constexpr vec& operator/=(T rhs);
+
+private:
+  std::array<T, N> data_;
+};
+
+typedef vec<double, 2> vec2d;
+typedef vec<double, 3> vec3d;
+typedef vec<double, 4> vec4d;
+
+// Registers for the vecs that fill them: load and store (aligned), splat,
+// and add, sub, mul and div lane by lane. enabled is false for the rest,
+// and for every vec under VECTOR_MATH_NO_SIMD.
+template <typename T, size_t N>
+struct vec_simd {
+  static constexpr bool enabled = false;
+};
+
+#if defined(VECTOR_MATH_SSE)
+template <>
+struct vec_simd<float, 4> {
+  static constexpr bool enabled = true;
+  typedef __m128 reg;
+  static reg load(const float* p) { return _mm_load_ps(p); }
+  static void store(float* p, reg a) { _mm_store_ps(p, a); }
+  static reg splat(float x) { return _mm_set1_ps(x); }
+  static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+  static reg div(reg a, reg b) { return _mm_div_ps(a, b); }
+};
+#elif defined(VECTOR_MATH_NEON)
+template <>
+struct vec_simd<float, 4> {
+  static constexpr bool enabled = true;
+  typedef float32x4_t reg;
+  static reg load(const float* p) { return vld1q_f32(p); }
+  static void store(float* p, reg a) { vst1q_f32(p, a); }
+  static reg splat(float x) { return vdupq_n_f32(x); }
+  static reg add(reg a, reg b) { return vaddq_f32(a, b); }
+  static reg sub(reg a, reg b) { return vsubq_f32(a, b); }
+  static reg mul(reg a, reg b) { return vmulq_f32(a, b); }
+  static reg div(reg a, reg b) { return vdivq_f32(a, b); }
+};
+#endif
+
+#if defined(VEC_SSE2)
+template <>
+struct vec_simd<double, 2> {
+  static constexpr bool enabled = true;
+  typedef __m128d reg;
+  static reg load(const double* p) { return _mm_load_pd(p); }
+  static void store(double* p, reg a) { _mm_store_pd(p, a); }
+  static reg splat(double x) { return _mm_set1_pd(x); }
+  static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_pd(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+  static reg div(reg a, reg b) { return _mm_div_pd(a, b); }
+};
+#elif defined(VECTOR_MATH_NEON)
+template <>
+struct vec_simd<double, 2> {
+  static constexpr bool enabled = true;
+  typedef float64x2_t reg;
+  static reg load(const double* p) { return vld1q_f64(p); }
+  static void store(double* p, reg a) { vst1q_f64(p, a); }
+  static reg splat(double x) { return vdupq_n_f64(x); }
+  static reg add(reg a, reg b) { return vaddq_f64(a, b); }
+  static reg sub(reg a, reg b) { return vsubq_f64(a, b); }
+  static reg mul(reg a, reg b) { return vmulq_f64(a, b); }
+  static reg div(reg a, reg b) { return vdivq_f64(a, b); }
+};
+#endif
+
+#if defined(VECTOR_MATH_AVX)
+template <>
+struct vec_simd<double, 4> {
+  static constexpr bool enabled = true;
+  typedef __m256d reg;
+  static reg load(const double* p) { return _mm256_load_pd(p); }
+  static void store(double* p, reg a) { _mm256_store_pd(p, a); }
+  static reg splat(double x) { return _mm256_set1_pd(x); }
+  static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+  static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+  static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+  static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+};
+#elif defined(VEC_SSE2) || defined(VECTOR_MATH_NEON)
+// two registers of double x 2 where there are no wider ones
+template <>
+struct vec_simd<double, 4> {
+  typedef vec_simd<double, 2> half;
+  static constexpr bool enabled = true;
+  struct reg { half::reg lo, hi; };
+  static reg load(const double* p) { reg r = { half::load(p), half::load(p + 2) }; return r; }
+  static void store(double* p, reg a) { half::store(p, a.lo); half::store(p + 2, a.hi); }
+  static reg splat(double x) { reg r = { half::splat(x), half::splat(x) }; return r; }
+  static reg add(reg a, reg b) { reg r = { half::add(a.lo, b.lo), half::add(a.hi, b.hi) }; return r; }
+  static reg sub(reg a, reg b) { reg r = { half::sub(a.lo, b.lo), half::sub(a.hi, b.hi) }; return r; }
+  static reg mul(reg a, reg b) { reg r = { half::mul(a.lo, b.lo), half::mul(a.hi, b.hi) }; return r; }
+  static reg div(reg a, reg b) { reg r = { half::div(a.lo, b.lo), half::div(a.hi, b.hi) }; return r; }
+};
+#endif
+
+template <typename T, size_t N>
+template <typename... Ts, typename>
+constexpr vec<T, N>::vec(Ts... components)
+  : data_{{T(components)...}}
+{}
+
+template <typename T, size_t N>
+constexpr vec<T, N>::vec(const vec<T, N - 1>& head, T last)
+  : data_()
+{
+  for (size_t i = 0; i + 1 < N; ++i) {
+    data_[i] = head[i];
+  }
+  data_[N - 1] = last;
+}
+
+template <typename T, size_t N>
+template <typename U>
+constexpr vec<T, N>::vec(const vec<U, N>& other)
+  : data_()
+{
+  for (size_t i = 0; i < N; ++i) {
+    data_[i] = T(other[i]);
+  }
+}
+
+template <typename T, size_t N>
+constexpr T vec<T, N>::x() const {
+  return (*this)[0];
+}
+
+template <typename T, size_t N>
+constexpr T vec<T, N>::y() const {
+  static_assert(N > 1, "no y component");
+  return (*this)[1];
+}
+
+template <typename T, size_t N>
+constexpr T vec<T, N>::z() const {
+  static_assert(N > 2, "no z component");
+  return (*this)[2];
+}
+
+template <typename T, size_t N>
+constexpr T vec<T, N>::w() const {
+  static_assert(N > 3, "no w component");
+  return (*this)[3];
+}
+
+template <typename T, size_t N>
+constexpr vec<T, 3> vec<T, N>::xyz() const {
+  static_assert(N > 3, "xyz of a vec with no more than three components");
+  return vec<T, 3>{(*this)[0], (*this)[1], (*this)[2]};
+}
+
+template <typename T, size_t N>
+constexpr const T* vec<T, N>::data() const {
+  return data_.data();
+}
+
+template <typename T, size_t N>
+constexpr T* vec<T, N>::data() {
+  return data_.data();
+}
+
+template <typename T, size_t N>
+constexpr const T& vec<T, N>::operator[](size_t i) const {
+  return data_[i];
+}
+
+template <typename T, size_t N>
+constexpr T& vec<T, N>::operator[](size_t i) {
+  return data_[i];
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N>& vec<T, N>::operator+=(const vec& rhs) {
+  typedef vec_simd<T, N> simd;
+  if constexpr (simd::enabled) {
+    if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+      simd::store(data(), simd::add(simd::load(data()), simd::load(rhs.data())));
+      return *this;
+    }
+  }
+  for (size_t i = 0; i < N; ++i) {
+    data_[i] += rhs[i];
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N>& vec<T, N>::operator-=(const vec& rhs) {
+  typedef vec_simd<T, N> simd;
+  if constexpr (simd::enabled) {
+    if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+      simd::store(data(), simd::sub(simd::load(data()), simd::load(rhs.data())));
+      return *this;
+    }
+  }
+  for (size_t i = 0; i < N; ++i) {
+    data_[i] -= rhs[i];
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N>& vec<T, N>::operator*=(T rhs) {
+  typedef vec_simd<T, N> simd;
+  if constexpr (simd::enabled) {
+    if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+      simd::store(data(), simd::mul(simd::load(data()), simd::splat(rhs)));
+      return *this;
+    }
+  }
+  for (size_t i = 0; i < N; ++i) {
+    data_[i] *= rhs;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N>& vec<T, N>::operator/=(T rhs) {
+  typedef vec_simd<T, N> simd;
+  if constexpr (simd::enabled) {
+    if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+      simd::store(data(), simd::div(simd::load(data()), simd::splat(rhs)));
+      return *this;
+    }
+  }
+  for (size_t i = 0; i < N; ++i) {
+    data_[i] /= rhs;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N> operator+(vec<T, N> lhs, const vec<T, N>& rhs) {
+  return lhs += rhs;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N> operator-(vec<T, N> lhs, const vec<T, N>& rhs) {
+  return lhs -= rhs;
+}
+
+// component by component
+template <typename T, size_t N>
+constexpr vec<T, N> operator*(vec<T, N> lhs, const vec<T, N>& rhs) {
+  typedef vec_simd<T, N> simd;
+  if constexpr (simd::enabled) {
+    if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+      simd::store(lhs.data(), simd::mul(simd::load(lhs.data()), simd::load(rhs.data())));
+      return lhs;
+    }
+  }
+  for (size_t i = 0; i < N; ++i) {
+    lhs[i] *= rhs[i];
+  }
+  return lhs;
+}
+
+// The scalars are not deduced, so that 2 * v and v / 2 convert the 2 to
+// T as they did for the float-only types.
+template <typename T, size_t N>
+constexpr vec<T, N> operator*(vec<T, N> lhs, typename vec<T, N>::value_type rhs) {
+  return lhs *= rhs;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N> operator*(typename vec<T, N>::value_type lhs, vec<T, N> rhs) {
+  return rhs *= lhs;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N> operator/(vec<T, N> lhs, typename vec<T, N>::value_type rhs) {
+  return lhs /= rhs;
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N> operator-(vec<T, N> rhs) {
+  for (size_t i = 0; i < N; ++i) {
+    rhs[i] = -rhs[i];
+  }
+  return rhs;
+}
+
+template <typename T, size_t N>
+constexpr T dot(const vec<T, N>& lhs, const vec<T, N>& rhs) {
+  T sum = lhs[0]*rhs[0];
+  for (size_t i = 1; i < N; ++i) {
+    sum += lhs[i]*rhs[i];
+  }
+  return sum;
+}
+
+template <typename T, size_t N>
+constexpr T magnitude_sq(const vec<T, N>& v) {
+  return dot(v, v);
+}
+
+template <size_t N>
+constexpr float magnitude(const vec<float, N>& v) {
+  return vector_math_sqrtf(magnitude_sq(v));
+}
+
+template <size_t N>
+constexpr double magnitude(const vec<double, N>& v) {
+  return vector_math_sqrt(magnitude_sq(v));
+}
+
+// Zero vectors stay zero.
+template <typename T, size_t N>
+constexpr vec<T, N> normalized(const vec<T, N>& v) {
+  T length = magnitude(v);
+  return length == 0 ? v : v * (1 / length);
+}
+
+template <typename T>
+constexpr vec<T, 3> cross(const vec<T, 3>& x, const vec<T, 3>& y) {
+  return vec<T, 3>(x[1]*y[2] - x[2]*y[1],
+                   x[2]*y[0] - x[0]*y[2],
+                   x[0]*y[1] - x[1]*y[0]);
+}
+
+template <typename T, size_t N>
+constexpr vec<T, N> interpolate(const vec<T, N>& begin, const vec<T, N>& end,
+                                typename vec<T, N>::value_type fraction) {
+  return begin + fraction * (end - begin);
+}
+
+#endif
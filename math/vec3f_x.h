@@ -0,0 +1,208 @@
+#ifndef VEC3F_X_H
+#define VEC3F_X_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "math/floatx.h"
+#include "math/vec3f.h"
+
+// N vec3fs held as x, y and z lanes (see floatx.h), with the operators of
+// vec3f applied to every lane at once. Kernels written against vec3fx<N>
+// compile for any width; vec3f_x4, vec3f_x8 and vec3f_x16 are the ones that
+// map onto SSE, AVX and AVX-512 registers.
+//
+// load and store move N consecutive vec3fs. gather and scatter take an index
+// per lane into an array of vec3fs, as Mesh::indexes index
+// Mesh::vertexes; indexes must stay below 2^31 / 3.
+namespace simd {
+  template <size_t N>
+  struct vec3fx {
+    vec3fx() = default;
+    vec3fx(floatx<N> x, floatx<N> y, floatx<N> z);
+    // v in every lane
+    explicit vec3fx(const vec3f& v);
+
+    vec3fx& operator+=(const vec3fx& rhs);
+    vec3fx& operator-=(const vec3fx& rhs);
+    vec3fx& operator/=(floatx<N> rhs);
+
+    floatx<N> x;
+    floatx<N> y;
+    floatx<N> z;
+  };
+
+  typedef vec3fx<4> vec3f_x4;
+  typedef vec3fx<8> vec3f_x8;
+  typedef vec3fx<16> vec3f_x16;
+
+  template <size_t N>
+  inline vec3fx<N>::vec3fx(floatx<N> x, floatx<N> y, floatx<N> z)
+    : x(x)
+    , y(y)
+    , z(z)
+  {}
+
+  template <size_t N>
+  inline vec3fx<N>::vec3fx(const vec3f& v)
+    : x(splat<N>(v[0]))
+    , y(splat<N>(v[1]))
+    , z(splat<N>(v[2]))
+  {}
+
+  template <size_t N>
+  inline vec3fx<N>& vec3fx<N>::operator+=(const vec3fx& rhs) {
+    x = x + rhs.x;
+    y = y + rhs.y;
+    z = z + rhs.z;
+    return *this;
+  }
+
+  template <size_t N>
+  inline vec3fx<N>& vec3fx<N>::operator-=(const vec3fx& rhs) {
+    x = x - rhs.x;
+    y = y - rhs.y;
+    z = z - rhs.z;
+    return *this;
+  }
+
+  template <size_t N>
+  inline vec3fx<N>& vec3fx<N>::operator/=(floatx<N> rhs) {
+    x = x / rhs;
+    y = y / rhs;
+    z = z / rhs;
+    return *this;
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator+(vec3fx<N> lhs, const vec3fx<N>& rhs) {
+    lhs += rhs;
+    return lhs;
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator-(vec3fx<N> lhs, const vec3fx<N>& rhs) {
+    lhs -= rhs;
+    return lhs;
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator*(const vec3fx<N>& lhs, const vec3fx<N>& rhs) {
+    return vec3fx<N>(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z);
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator-(const vec3fx<N>& rhs) {
+    return vec3fx<N>(-rhs.x, -rhs.y, -rhs.z);
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator/(vec3fx<N> lhs, floatx<N> rhs) {
+    lhs /= rhs;
+    return lhs;
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator*(floatx<N> lhs, const vec3fx<N>& rhs) {
+    return vec3fx<N>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z);
+  }
+
+  template <size_t N>
+  inline vec3fx<N> operator*(const vec3fx<N>& lhs, floatx<N> rhs) {
+    return rhs * lhs;
+  }
+
+  template <size_t N>
+  inline floatx<N> dot(const vec3fx<N>& x, const vec3fx<N>& y) {
+    return x.x*y.x + x.y*y.y + x.z*y.z;
+  }
+
+  template <size_t N>
+  inline vec3fx<N> cross(const vec3fx<N>& x, const vec3fx<N>& y) {
+    return vec3fx<N>(x.y*y.z - x.z*y.y,
+                     x.z*y.x - x.x*y.z,
+                     x.x*y.y - x.y*y.x);
+  }
+
+  template <size_t N>
+  inline floatx<N> magnitude_sq(const vec3fx<N>& x) {
+    return dot(x, x);
+  }
+
+  template <size_t N>
+  inline floatx<N> magnitude(const vec3fx<N>& x) {
+    return sqrt(magnitude_sq(x));
+  }
+
+  // Zero vectors stay zero, as with normalized(vec3f).
+  template <size_t N>
+  inline vec3fx<N> normalized(const vec3fx<N>& x) {
+    floatx<N> length = magnitude(x);
+    floatx<N> scale = select(length > splat<N>(0.f),
+      splat<N>(1.f) / length, splat<N>(1.f));
+    return x * scale;
+  }
+
+  template <size_t N>
+  inline vec3fx<N> interpolate(const vec3fx<N>& begin, const vec3fx<N>& end,
+                               floatx<N> fraction) {
+    return begin + fraction * (end - begin);
+  }
+
+  // a in the lanes where m is set, b in the others
+  template <size_t N>
+  inline vec3fx<N> select(maskx<N> m, const vec3fx<N>& a, const vec3fx<N>& b) {
+    return vec3fx<N>(select(m, a.x, b.x), select(m, a.y, b.y), select(m, a.z, b.z));
+  }
+
+  template <size_t N>
+  inline vec3fx<N> gather(const vec3f* base, const unsigned* indexes) {
+    int32_t offsets[N];
+    for (size_t i = 0; i < N; ++i) {
+      offsets[i] = (int32_t)(3 * indexes[i]);
+    }
+    const float* p = base->data();
+    return vec3fx<N>(gather<N>(p, offsets), gather<N>(p + 1, offsets),
+                     gather<N>(p + 2, offsets));
+  }
+
+  template <size_t N>
+  inline void scatter(vec3f* base, const unsigned* indexes, const vec3fx<N>& v) {
+    int32_t offsets[N];
+    for (size_t i = 0; i < N; ++i) {
+      offsets[i] = (int32_t)(3 * indexes[i]);
+    }
+    float* p = base->data();
+    scatter(p, offsets, v.x);
+    scatter(p + 1, offsets, v.y);
+    scatter(p + 2, offsets, v.z);
+  }
+
+  template <size_t N>
+  inline vec3fx<N> load(const vec3f* p) {
+    float x[N], y[N], z[N];
+    for (size_t i = 0; i < N; ++i) {
+      x[i] = p[i][0];
+      y[i] = p[i][1];
+      z[i] = p[i][2];
+    }
+    return vec3fx<N>(load<N>(x), load<N>(y), load<N>(z));
+  }
+
+  template <size_t N>
+  inline void store(vec3f* p, const vec3fx<N>& v) {
+    float x[N], y[N], z[N];
+    store(x, v.x);
+    store(y, v.y);
+    store(z, v.z);
+    for (size_t i = 0; i < N; ++i) {
+      p[i] = vec3f(x[i], y[i], z[i]);
+    }
+  }
+
+  template <size_t N>
+  inline vec3f lane(const vec3fx<N>& v, size_t i) {
+    return vec3f(lane(v.x, i), lane(v.y, i), lane(v.z, i));
+  }
+}
+
+#endif
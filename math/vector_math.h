@@ -2,42 +2,166 @@
 #define VECTOR_MATH_H
 
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 #include "math/restrict.h"
 
-inline void v3f_cross_v3fo(const float* x, const float* y, float* RESTRICT result) {
+// The matrix products have SIMD versions for SSE (always on x86-64), AVX
+// when the compiler targets it (GRAD_AVX2 in CMake) and NEON on AArch64,
+// behind the same signatures as the plain C++ ones. The plain versions stay
+// available with a _scalar suffix, as a reference and for benchmarks.
+// Defining VECTOR_MATH_NO_SIMD keeps to the plain versions everywhere, as
+// the scalar build of misc/cpu_kernels.cxx does.
+//
+// Everything without intrinsics is constexpr. The SIMD products are not;
+// the operators of mat4f and mat3f switch to the _scalar versions in
+// constant expressions instead.
+#if defined(VECTOR_MATH_NO_SIMD)
+#elif defined(__AVX__)
+#include <immintrin.h>
+#define VECTOR_MATH_AVX
+#define VECTOR_MATH_SSE
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define VECTOR_MATH_SSE
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VECTOR_MATH_NEON
+#endif
+
+// True while the compiler is evaluating a constant expression, where the
+// intrinsics and the libm calls cannot run. The constexpr functions use it
+// to take a plain path there and keep to the fast one at run time. Where
+// the builtin is missing constant evaluation only works with
+// VECTOR_MATH_NO_SIMD.
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define VECTOR_MATH_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define VECTOR_MATH_CONSTANT_EVALUATED() false
+#endif
+
+// "avx", "sse", "neon" or "scalar"
+inline const char* vector_math_isa() {
+#if defined(VECTOR_MATH_AVX)
+  return "avx";
+#elif defined(VECTOR_MATH_SSE)
+  return "sse";
+#elif defined(VECTOR_MATH_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
+
+// sqrt, sin and cos, with versions for constant expressions that are
+// worked in double and agree with libm to within a rounding.
+constexpr double vector_math_sqrt(double x) {
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return sqrt(x);
+  }
+  if (!(x > 0.) || x == HUGE_VAL) {
+    return x == 0. || x == HUGE_VAL ? x : NAN;
+  }
+  // Newton's method from above comes down without oscillating
+  double root = x < 1. ? 1. : x;
+  for (double last = 0.; root != last; ) {
+    last = root;
+    root = 0.5 * (root + x / root);
+    if (root >= last) {
+      break;
+    }
+  }
+  return root;
+}
+
+constexpr float vector_math_sqrtf(float x) {
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return sqrtf(x);
+  }
+  return (float)vector_math_sqrt(x);
+}
+
+constexpr double vector_math_sin(double x) {
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return sin(x);
+  }
+  const double pi = 3.14159265358979323846;
+  // into [-pi, pi], then [-pi/2, pi/2] with sin(pi - x) = sin(x), where
+  // the Taylor series is exact in double well before its 20th term
+  x -= 2*pi * (double)(long long)(x / (2*pi));
+  if (x > pi) {
+    x -= 2*pi;
+  } else if (x < -pi) {
+    x += 2*pi;
+  }
+  if (x > pi/2) {
+    x = pi - x;
+  } else if (x < -pi/2) {
+    x = -pi - x;
+  }
+  double term = x;
+  double sum = x;
+  for (int i = 1; i < 20; ++i) {
+    term *= -x * x / ((2*i) * (2*i + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double vector_math_cos(double x) {
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return cos(x);
+  }
+  return vector_math_sin(x + 3.14159265358979323846 / 2);
+}
+
+constexpr float vector_math_sinf(float x) {
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return sinf(x);
+  }
+  return (float)vector_math_sin(x);
+}
+
+constexpr float vector_math_cosf(float x) {
+  if (!VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return cosf(x);
+  }
+  return (float)vector_math_cos(x);
+}
+
+constexpr void v3f_cross_v3fo(const float* x, const float* y, float* RESTRICT result) {
   result[0] = x[1]*y[2] - x[2]*y[1];
   result[1] = x[2]*y[0] - x[0]*y[2];
   result[2] = x[0]*y[1] - x[1]*y[0];
 }
 
-inline float magnitude_sq_v3f(const float* x) {
+constexpr float magnitude_sq_v3f(const float* x) {
   return x[0]*x[0] + x[1]*x[1] + x[2]*x[2];
 }
 
-inline float magnitude_v3f(const float* x) {
-  return sqrtf(magnitude_sq_v3f(x));
+constexpr float magnitude_v3f(const float* x) {
+  return vector_math_sqrtf(magnitude_sq_v3f(x));
 }
 
-inline void scale_v3f(float scalar, float* x) {
+constexpr void scale_v3f(float scalar, float* x) {
   x[0] *= scalar;
   x[1] *= scalar;
   x[2] *= scalar;
 }
 
-inline void translate_v3fo(float x, float y, float z, const float* v, float* RESTRICT result) {
+constexpr void translate_v3fo(float x, float y, float z, const float* v, float* RESTRICT result) {
   result[0] = v[0] + x;
   result[1] = v[1] + y;
   result[2] = v[2] + z;
 }
 
-inline void difference_v3fo(const float* x, const float* y, float* RESTRICT result) {
+constexpr void difference_v3fo(const float* x, const float* y, float* RESTRICT result) {
   result[0] = x[0] - y[0];
   result[1] = x[1] - y[1];
   result[2] = x[2] - y[2];
 }
 
-inline void normalize_v3f(float* x) {
+constexpr void normalize_v3f(float* x) {
   float magnitude = magnitude_v3f(x);
   if (magnitude == 0.f) {
     return; // not really sure what to do about this...
@@ -45,11 +169,82 @@ inline void normalize_v3f(float* x) {
   scale_v3f(1/magnitude, x);
 }
 
-inline void m3f_copy_m3fo(const float* m, float* RESTRICT result) {
+// Faster, less accurate versions for hot loops, chosen per call site by
+// calling the _fast function, or by a MathPrecision argument where a
+// function offers both. The errors are bounds for any conforming hardware,
+// not what one CPU happens to give, and grad_bench checks them.
+enum MathPrecision {
+  MATH_PRECISE,
+  MATH_FAST,
+};
+
+// 1/sqrt(x) for x > 0, within 4e-7 of it relative to its size: the
+// hardware estimate (or the integer trick without SIMD) with Newton steps.
+// x86 only guarantees rsqrtss to 1.5 * 2^-12 relative. One Newton step
+// takes an error e to 1.5 e^2, here 2.0e-7, and its roundings add at most
+// three times 2^-24, 1.8e-7. The NEON estimate and the integer trick take
+// enough steps that only the roundings are left.
+constexpr float rsqrtf_fast(float x) {
+  if (VECTOR_MATH_CONSTANT_EVALUATED()) {
+    return 1.f / vector_math_sqrtf(x);
+  }
+#if defined(VECTOR_MATH_SSE)
+  float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+  return y * (1.5f - 0.5f * x * y * y);
+#elif defined(VECTOR_MATH_NEON)
+  float32x2_t v = vdup_n_f32(x);
+  float32x2_t y = vrsqrte_f32(v);
+  y = vmul_f32(y, vrsqrts_f32(vmul_f32(v, y), y));
+  y = vmul_f32(y, vrsqrts_f32(vmul_f32(v, y), y));
+  return vget_lane_f32(y, 0);
+#else
+  uint32_t bits = 0;
+  memcpy(&bits, &x, sizeof(bits));
+  bits = 0x5f375a86u - (bits >> 1);
+  float y = 0;
+  memcpy(&y, &bits, sizeof(y));
+  for (int i = 0; i < 3; ++i) {
+    y = y * (1.5f - 0.5f * x * y * y);
+  }
+  return y;
+#endif
+}
+
+constexpr float magnitude_v3f_fast(const float* x) {
+  float magnitude_sq = magnitude_sq_v3f(x);
+  return magnitude_sq == 0.f ? 0.f : magnitude_sq * rsqrtf_fast(magnitude_sq);
+}
+
+// within 6e-7 of the length relative to it: the 4e-7 of rsqrtf_fast,
+// half the 3 * 2^-24 of summing the squares, and the rounding of the scale
+constexpr void normalize_v3f_fast(float* x) {
+  float magnitude_sq = magnitude_sq_v3f(x);
+  if (magnitude_sq == 0.f) {
+    return;
+  }
+  scale_v3f(rsqrtf_fast(magnitude_sq), x);
+}
+
+// acos(x) for x in [-1, 1], within 6.8e-5 radians: Abramowitz and Stegun
+// 4.4.45, a cubic in |x| times sqrt(1 - |x|), reflected for x < 0.
+constexpr float acosf_fast(float x) {
+  float a = x < 0.f ? -x : x;
+  float r = vector_math_sqrtf(1.f - a)
+    * (1.5707288f + a*(-0.2121144f + a*(0.0742610f + a*-0.0187293f)));
+  return x < 0.f ? 3.14159265f - r : r;
+}
+
+constexpr void m3f_copy_m3fo(const float* m, float* RESTRICT result) {
+  if (VECTOR_MATH_CONSTANT_EVALUATED()) {
+    for (size_t i = 0; i < 9; ++i) {
+      result[i] = m[i];
+    }
+    return;
+  }
   memcpy(result, m, 9 * sizeof(float));
 }
 
-inline void m3f_mul_m3fo(const float* m, const float* n, float* RESTRICT result) {
+constexpr void m3f_mul_m3fo_scalar(const float* m, const float* n, float* RESTRICT result) {
   result[0] = m[0]*n[0] + m[1]*n[3] + m[2]*n[6];
   result[1] = m[0]*n[1] + m[1]*n[4] + m[2]*n[7];
   result[2] = m[0]*n[2] + m[1]*n[5] + m[2]*n[8];
@@ -63,63 +258,96 @@ inline void m3f_mul_m3fo(const float* m, const float* n, float* RESTRICT result)
   result[8] = m[6]*n[2] + m[7]*n[5] + m[8]*n[8];
 }
 
-inline void m3f_mul_v3fo(const float* m, const float* v, float* RESTRICT result) {
+#if defined(VECTOR_MATH_SSE)
+// Each row of the result is a sum of the rows of n scaled by a row of m.
+// The rows of n are loaded four floats at a time except for the last one,
+// which would read past the end, and the stores overlap so that only the
+// last row needs splitting.
+inline void m3f_mul_m3fo(const float* m, const float* n, float* RESTRICT result) {
+  __m128 n0 = _mm_loadu_ps(n);
+  __m128 n1 = _mm_loadu_ps(n + 3);
+  __m128 n2 = _mm_setr_ps(n[6], n[7], n[8], 0);
+  __m128 rows[3];
+  for (size_t i = 0; i < 3; ++i) {
+    const float* row = m + 3*i;
+    rows[i] = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(row[0]), n0),
+                 _mm_mul_ps(_mm_set1_ps(row[1]), n1)),
+      _mm_mul_ps(_mm_set1_ps(row[2]), n2));
+  }
+  _mm_storeu_ps(result, rows[0]);
+  _mm_storeu_ps(result + 3, rows[1]);
+  _mm_storel_pi((__m64*)(result + 6), rows[2]);
+  _mm_store_ss(result + 8, _mm_movehl_ps(rows[2], rows[2]));
+}
+#else
+inline void m3f_mul_m3fo(const float* m, const float* n, float* RESTRICT result) {
+  m3f_mul_m3fo_scalar(m, n, result);
+}
+#endif
+
+constexpr void m3f_mul_v3fo(const float* m, const float* v, float* RESTRICT result) {
   result[0] = m[0]*v[0] + m[1]*v[1] + m[2]*v[2];
   result[1] = m[3]*v[0] + m[4]*v[1] + m[5]*v[2];
   result[2] = m[6]*v[0] + m[7]*v[1] + m[8]*v[2];
 }
 
-inline void m3f_mul_av3fo(float* m, const float* input, size_t count, float* RESTRICT result) {
-  size_t i;
-  for(i = 0; i < count; i += 3) {
+constexpr void m3f_mul_av3fo(float* m, const float* input, size_t count, float* RESTRICT result) {
+  for(size_t i = 0; i < count; i += 3) {
     m3f_mul_v3fo(m, input + i, result + i);
   }
 }
 
-inline void m3f_fill_rotx_m3fo(float rx, float* result) {
+constexpr void m3f_fill_rotx_m3fo(float rx, float* result) {
   float m[] = {
     1,  0,         0,
-    0,  cosf(rx), -sinf(rx),
-    0,  sinf(rx),  cosf(rx),
+    0,  vector_math_cosf(rx), -vector_math_sinf(rx),
+    0,  vector_math_sinf(rx),  vector_math_cosf(rx),
   };
   m3f_copy_m3fo(m, result);
 }
 
-inline void m3f_fill_roty_m3fo(float ry, float* result) {
+constexpr void m3f_fill_roty_m3fo(float ry, float* result) {
   float m[] = {
-    cosf(ry),  0,  sinf(ry),
+    vector_math_cosf(ry),  0,  vector_math_sinf(ry),
     0,         1,  0,
-   -sinf(ry),  0,  cosf(ry),
+   -vector_math_sinf(ry),  0,  vector_math_cosf(ry),
   };
   m3f_copy_m3fo(m, result);
 }
 
-inline void m3f_fill_rotz_m3fo(float rz, float* result) {
+constexpr void m3f_fill_rotz_m3fo(float rz, float* result) {
   float m[] = {
-    cosf(rz), -sinf(rz), 0,
-    sinf(rz),  cosf(rz), 0,
+    vector_math_cosf(rz), -vector_math_sinf(rz), 0,
+    vector_math_sinf(rz),  vector_math_cosf(rz), 0,
     0,         0,        1,
   };
   m3f_copy_m3fo(m, result);
 }
 
-inline void rotatex_v3fo(float rx, const float* v, float* RESTRICT result) {
-  float rm[9];
+constexpr void rotatex_v3fo(float rx, const float* v, float* RESTRICT result) {
+  float rm[9] = {};
   m3f_fill_rotx_m3fo(rx, rm);
-  m3f_mul_m3fo(rm, v, result);
+  m3f_mul_v3fo(rm, v, result);
 }
 
-inline void rotatey_v3fo(float ry, const float* v, float* RESTRICT result) {
-  float rm[16];
+constexpr void rotatey_v3fo(float ry, const float* v, float* RESTRICT result) {
+  float rm[9] = {};
   m3f_fill_roty_m3fo(ry, rm);
-  m3f_mul_m3fo(rm, v, result);
+  m3f_mul_v3fo(rm, v, result);
 }
 
-inline void m4f_copy_m4fo(const float* m, float* RESTRICT result) {
+constexpr void m4f_copy_m4fo(const float* m, float* RESTRICT result) {
+  if (VECTOR_MATH_CONSTANT_EVALUATED()) {
+    for (size_t i = 0; i < 16; ++i) {
+      result[i] = m[i];
+    }
+    return;
+  }
   memcpy(result, m, 16 * sizeof(float));
 }
 
-inline void m4f_mul_m4fo(const float* m, const float* n, float* RESTRICT result) {
+constexpr void m4f_mul_m4fo_scalar(const float* m, const float* n, float* RESTRICT result) {
   result[ 0] = m[ 0]*n[ 0] + m[ 1]*n[ 4] + m[ 2]*n[ 8] + m[ 3]*n[12];
   result[ 1] = m[ 0]*n[ 1] + m[ 1]*n[ 5] + m[ 2]*n[ 9] + m[ 3]*n[13];
   result[ 2] = m[ 0]*n[ 2] + m[ 1]*n[ 6] + m[ 2]*n[10] + m[ 3]*n[14];
@@ -141,43 +369,171 @@ inline void m4f_mul_m4fo(const float* m, const float* n, float* RESTRICT result)
   result[15] = m[12]*n[ 3] + m[13]*n[ 7] + m[14]*n[11] + m[15]*n[15];
 }
 
+// Row i of the result is m[i][0] * n[0] + ... + m[i][3] * n[3], where n[k]
+// is row k of n, so every row is four broadcasts and four multiply-adds.
+#if defined(VECTOR_MATH_AVX)
+// two rows of the result at a time, with the rows of n in both halves
+inline void m4f_mul_m4fo(const float* m, const float* n, float* RESTRICT result) {
+  __m256 n0 = _mm256_broadcast_ps((const __m128*)n);
+  __m256 n1 = _mm256_broadcast_ps((const __m128*)(n + 4));
+  __m256 n2 = _mm256_broadcast_ps((const __m128*)(n + 8));
+  __m256 n3 = _mm256_broadcast_ps((const __m128*)(n + 12));
+  for (size_t i = 0; i < 16; i += 8) {
+    // two 16-byte loads rather than one 32-byte one, which could not be
+    // forwarded from the row stores of a matrix that was just built
+    __m256 rows = _mm256_insertf128_ps(
+      _mm256_castps128_ps256(_mm_loadu_ps(m + i)), _mm_loadu_ps(m + i + 4), 1);
+    __m256 r = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x00), n0);
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x55), n1));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xaa), n2));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xff), n3));
+    _mm256_storeu_ps(result + i, r);
+  }
+}
+#elif defined(VECTOR_MATH_SSE)
+inline void m4f_mul_m4fo(const float* m, const float* n, float* RESTRICT result) {
+  __m128 n0 = _mm_loadu_ps(n);
+  __m128 n1 = _mm_loadu_ps(n + 4);
+  __m128 n2 = _mm_loadu_ps(n + 8);
+  __m128 n3 = _mm_loadu_ps(n + 12);
+  for (size_t i = 0; i < 16; i += 4) {
+    __m128 r = _mm_mul_ps(_mm_set1_ps(m[i]), n0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m[i + 1]), n1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m[i + 2]), n2));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(m[i + 3]), n3));
+    _mm_storeu_ps(result + i, r);
+  }
+}
+#elif defined(VECTOR_MATH_NEON)
+inline void m4f_mul_m4fo(const float* m, const float* n, float* RESTRICT result) {
+  float32x4_t n0 = vld1q_f32(n);
+  float32x4_t n1 = vld1q_f32(n + 4);
+  float32x4_t n2 = vld1q_f32(n + 8);
+  float32x4_t n3 = vld1q_f32(n + 12);
+  for (size_t i = 0; i < 16; i += 4) {
+    float32x4_t r = vmulq_n_f32(n0, m[i]);
+    r = vmlaq_n_f32(r, n1, m[i + 1]);
+    r = vmlaq_n_f32(r, n2, m[i + 2]);
+    r = vmlaq_n_f32(r, n3, m[i + 3]);
+    vst1q_f32(result + i, r);
+  }
+}
+#else
+inline void m4f_mul_m4fo(const float* m, const float* n, float* RESTRICT result) {
+  m4f_mul_m4fo_scalar(m, n, result);
+}
+#endif
+
+// A row of a 4x4 matrix held in a register, and the product of a row and a
+// matrix, which is the row of m * n for that row of m. Chains of products
+// can pass rows from one to the next without storing whole matrices (see
+// mat4f_product). The sums are in the same order as in m4f_mul_m4fo.
+#if defined(VECTOR_MATH_SSE)
+#define VECTOR_MATH_ROWS
+typedef __m128 m4f_row;
+
+inline m4f_row m4f_load_row(const float* m, size_t i) {
+  return _mm_loadu_ps(m + 4*i);
+}
+
+inline void m4f_store_row(m4f_row row, float* m, size_t i) {
+  _mm_storeu_ps(m + 4*i, row);
+}
+
+inline m4f_row m4f_row_mul_m4f(m4f_row row, const float* n) {
+  __m128 r = _mm_mul_ps(_mm_shuffle_ps(row, row, 0x00), _mm_loadu_ps(n));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, 0x55), _mm_loadu_ps(n + 4)));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, 0xaa), _mm_loadu_ps(n + 8)));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, 0xff), _mm_loadu_ps(n + 12)));
+  return r;
+}
+#elif defined(VECTOR_MATH_NEON)
+#define VECTOR_MATH_ROWS
+typedef float32x4_t m4f_row;
+
+inline m4f_row m4f_load_row(const float* m, size_t i) {
+  return vld1q_f32(m + 4*i);
+}
+
+inline void m4f_store_row(m4f_row row, float* m, size_t i) {
+  vst1q_f32(m + 4*i, row);
+}
+
+inline m4f_row m4f_row_mul_m4f(m4f_row row, const float* n) {
+  float32x4_t r = vmulq_laneq_f32(vld1q_f32(n), row, 0);
+  r = vmlaq_laneq_f32(r, vld1q_f32(n + 4), row, 1);
+  r = vmlaq_laneq_f32(r, vld1q_f32(n + 8), row, 2);
+  r = vmlaq_laneq_f32(r, vld1q_f32(n + 12), row, 3);
+  return r;
+}
+#endif
+
 inline void m4f_mul_m4f(const float* in, float* RESTRICT in_out) {
   float temp[16];
   m4f_mul_m4fo(in, in_out, temp);
   m4f_copy_m4fo(temp, in_out);
 }
 
-inline void m4f_mul_v4fo(const float* m, const float* v, float* RESTRICT result) {
+constexpr void m4f_mul_v4fo_scalar(const float* m, const float* v, float* RESTRICT result) {
   result[0] = m[ 0]*v[0] + m[ 1]*v[1] + m[ 2]*v[2] + m[ 3]*v[3];
   result[1] = m[ 4]*v[0] + m[ 5]*v[1] + m[ 6]*v[2] + m[ 7]*v[3];
   result[2] = m[ 8]*v[0] + m[ 9]*v[1] + m[10]*v[2] + m[11]*v[3];
   result[3] = m[12]*v[0] + m[13]*v[1] + m[14]*v[2] + m[15]*v[3];
 }
 
-inline void m4f_fill_rotx_m4fo(float rx, float* result) {
+// The result is the columns of m scaled by the elements of v.
+#if defined(VECTOR_MATH_SSE)
+inline void m4f_mul_v4fo(const float* m, const float* v, float* RESTRICT result) {
+  __m128 c0 = _mm_loadu_ps(m);
+  __m128 c1 = _mm_loadu_ps(m + 4);
+  __m128 c2 = _mm_loadu_ps(m + 8);
+  __m128 c3 = _mm_loadu_ps(m + 12);
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+  __m128 r = _mm_mul_ps(c0, _mm_set1_ps(v[0]));
+  r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+  r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+  r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(v[3])));
+  _mm_storeu_ps(result, r);
+}
+#elif defined(VECTOR_MATH_NEON)
+inline void m4f_mul_v4fo(const float* m, const float* v, float* RESTRICT result) {
+  float32x4x4_t c = vld4q_f32(m);
+  float32x4_t r = vmulq_n_f32(c.val[0], v[0]);
+  r = vmlaq_n_f32(r, c.val[1], v[1]);
+  r = vmlaq_n_f32(r, c.val[2], v[2]);
+  r = vmlaq_n_f32(r, c.val[3], v[3]);
+  vst1q_f32(result, r);
+}
+#else
+inline void m4f_mul_v4fo(const float* m, const float* v, float* RESTRICT result) {
+  m4f_mul_v4fo_scalar(m, v, result);
+}
+#endif
+
+constexpr void m4f_fill_rotx_m4fo(float rx, float* result) {
   float m[] = {
     1,  0,         0,        0,
-    0,  cosf(rx), -sinf(rx), 0,
-    0,  sinf(rx),  cosf(rx), 0,
+    0,  vector_math_cosf(rx), -vector_math_sinf(rx), 0,
+    0,  vector_math_sinf(rx),  vector_math_cosf(rx), 0,
     0,  0,         0,        1,
   };
   m4f_copy_m4fo(m, result);
 }
 
-inline void m4f_fill_roty_m4fo(float ry, float* result) {
+constexpr void m4f_fill_roty_m4fo(float ry, float* result) {
   float m[] = {
-    cosf(ry),  0,  sinf(ry), 0,
+    vector_math_cosf(ry),  0,  vector_math_sinf(ry), 0,
     0,         1,  0,        0,
-   -sinf(ry),  0,  cosf(ry), 0,
+   -vector_math_sinf(ry),  0,  vector_math_cosf(ry), 0,
     0,         0,  0,        1,
   };
   m4f_copy_m4fo(m, result);
 }
 
-inline void m4f_fill_rotz_m4fo(float rz, float* result) {
+constexpr void m4f_fill_rotz_m4fo(float rz, float* result) {
   float m[] = {
-    cosf(rz), -sinf(rz), 0,  0,
-    sinf(rz),  cosf(rz), 0,  0,
+    vector_math_cosf(rz), -vector_math_sinf(rz), 0,  0,
+    vector_math_sinf(rz),  vector_math_cosf(rz), 0,  0,
     0,         0,        1,  0,
     0,         0,        0,  1,
   };
@@ -187,16 +543,16 @@ inline void m4f_fill_rotz_m4fo(float rz, float* result) {
 inline void rotatex_v4fo(float rx, const float* v, float* RESTRICT result) {
   float rm[16];
   m4f_fill_rotx_m4fo(rx, rm);
-  m4f_mul_m4fo(rm, v, result);
+  m4f_mul_v4fo(rm, v, result);
 }
 
 inline void rotatey_v4fo(float ry, const float* v, float* RESTRICT result) {
   float rm[16];
   m4f_fill_roty_m4fo(ry, rm);
-  m4f_mul_m4fo(rm, v, result);
+  m4f_mul_v4fo(rm, v, result);
 }
 
-inline void m4f_fill_scale_m4fo(float sx, float sy, float sz, float* result) {
+constexpr void m4f_fill_scale_m4fo(float sx, float sy, float sz, float* result) {
   float m[] = {
     sx, 0,  0,  0,
     0,  sy, 0,  0,
@@ -206,7 +562,7 @@ inline void m4f_fill_scale_m4fo(float sx, float sy, float sz, float* result) {
   m4f_copy_m4fo(m, result);
 }
 
-inline void m4f_fill_trans_m4fo(float x, float y, float z, float* result) {
+constexpr void m4f_fill_trans_m4fo(float x, float y, float z, float* result) {
   float m[] = {
     1, 0, 0, x,
     0, 1, 0, y,
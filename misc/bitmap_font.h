@@ -0,0 +1,29 @@
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include <stddef.h>
+
+// A 5x7 pixel font covering printable ASCII, for overlays that should not
+// depend on font files at run time.
+
+const size_t k_glyph_width = 5;
+const size_t k_glyph_height = 7;
+const char k_glyph_first = ' ';
+// a filled cell after '~', usable as a solid texel for boxes and graphs
+const char k_glyph_solid = 127;
+const size_t k_glyph_count = k_glyph_solid - k_glyph_first + 1;
+
+// The rows of a glyph from the top, one bit per pixel with the leftmost
+// pixel in bit 4. Characters outside the font map to '?'.
+const unsigned char* bitmap_font_glyph(char c);
+
+// Packs every glyph into an 8-bit coverage atlas of columns cells across,
+// each cell_width by cell_height texels with the glyph in its top-left
+// corner. Row 0 of the atlas is its top row. out must hold
+// atlas width * height bytes, as returned by bitmap_font_atlas_size.
+void bitmap_font_atlas_size(size_t columns, size_t cell_width, size_t cell_height,
+                            size_t* width, size_t* height);
+void bitmap_font_atlas(size_t columns, size_t cell_width, size_t cell_height,
+                       unsigned char* out);
+
+#endif
@@ -0,0 +1,48 @@
+#include <stdio.h>
+#include <string.h>
+#include <cmath>
+#include "misc/camera_script.h"
+
+bool load_camera_script(const char* filename, std::vector<CameraState>* states) {
+  FILE* file = fopen(filename, "r");
+  if (!file) {
+    fprintf(stderr, "Could not open camera script: %s\n", filename);
+    return false;
+  }
+
+  char line[512];
+  int line_number = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), file)) {
+    ++line_number;
+    const char* text = line + strspn(line, " \t");
+    if (*text == '#' || *text == '\n' || *text == '\r' || *text == '\0') {
+      continue;
+    }
+
+    float values[7];
+    if (sscanf(text, "%f %f %f %f %f %f %f", &values[0], &values[1], &values[2],
+          &values[3], &values[4], &values[5], &values[6]) != 7) {
+      fprintf(stderr, "%s:%d: expected 7 numbers: %s", filename, line_number, line);
+      ok = false;
+      break;
+    }
+    float length = std::sqrt(values[3]*values[3] + values[4]*values[4]
+      + values[5]*values[5] + values[6]*values[6]);
+    if (length == 0) {
+      fprintf(stderr, "%s:%d: orientation is zero\n", filename, line_number);
+      ok = false;
+      break;
+    }
+
+    CameraState state;
+    state.scale = values[0];
+    state.pan = vec2f{values[1], values[2]};
+    state.orient = quaternion(values[3] / length,
+      vec3f{values[4] / length, values[5] / length, values[6] / length});
+    states->push_back(state);
+  }
+
+  fclose(file);
+  return ok;
+}
@@ -0,0 +1,23 @@
+#ifndef CAMERA_SCRIPT_H
+#define CAMERA_SCRIPT_H
+
+#include <vector>
+#include "math/quaternion.h"
+#include "math/vec2f.h"
+
+// One frame of a scripted camera: the values of g_scale, g_pan and g_orient.
+struct CameraState {
+  float scale;
+  vec2f pan;
+  quaternion orient;
+};
+
+// Reads one camera state per line as
+//
+//   scale pan_x pan_y orient_s orient_x orient_y orient_z
+//
+// Blank lines and lines starting with # are skipped. The orientation is
+// normalised. Returns false and prints the offending line on a parse error.
+bool load_camera_script(const char* filename, std::vector<CameraState>* states);
+
+#endif
@@ -1,8 +1,32 @@
 #ifndef COLORMAP_H
 #define COLORMAP_H
 
+#include <stddef.h>
+
 extern const float k_viridis[];
 extern const size_t k_viridis_size;
 extern const size_t k_viridis_count;
 
+enum ColormapId {
+  COLORMAP_VIRIDIS,
+  COLORMAP_MAGMA,
+  COLORMAP_INFERNO,
+  COLORMAP_PLASMA,
+  COLORMAP_CIVIDIS,
+  COLORMAP_COUNT,
+};
+
+// every colormap in the registry has the same number of entries
+const size_t k_colormap_width = 256;
+
+extern const char* const k_colormap_names[COLORMAP_COUNT];
+
+// entry i of the given colormap, as floating point RGB
+void colormap_rgb(ColormapId id, size_t i, float* rgb);
+
+// Packs every colormap as RGBA8, one row of k_colormap_width texels per
+// map in ColormapId order, ready to upload as a 1D texture array.
+// out must hold 4 * k_colormap_width * COLORMAP_COUNT bytes.
+void pack_colormaps_rgba8(unsigned char* out);
+
 #endif
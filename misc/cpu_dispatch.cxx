@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <string.h>
+#include "misc/cpu_dispatch.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CPU_DISPATCH_X86
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define CPU_DISPATCH_X86
+#endif
+
+// One table per build of misc/cpu_kernels.cxx; CMake says which of the
+// optional ones exist.
+extern const CpuKernels k_cpu_kernels_scalar;
+extern const CpuKernels k_cpu_kernels_baseline;
+#if defined(GRAD_CPU_KERNELS_AVX2)
+extern const CpuKernels k_cpu_kernels_avx2;
+#endif
+#if defined(GRAD_CPU_KERNELS_AVX512)
+extern const CpuKernels k_cpu_kernels_avx512;
+#endif
+
+namespace {
+  const CpuKernels* const k_tables[] = {
+#if defined(GRAD_CPU_KERNELS_AVX512)
+    &k_cpu_kernels_avx512,
+#endif
+#if defined(GRAD_CPU_KERNELS_AVX2)
+    &k_cpu_kernels_avx2,
+#endif
+    &k_cpu_kernels_baseline,
+    &k_cpu_kernels_scalar,
+  };
+  const size_t k_table_count = sizeof(k_tables) / sizeof(k_tables[0]);
+
+  const CpuKernels* g_forced = NULL;
+
+#if defined(CPU_DISPATCH_X86)
+  struct CpuidRegisters {
+    unsigned eax;
+    unsigned ebx;
+    unsigned ecx;
+    unsigned edx;
+  };
+
+  CpuidRegisters cpuid(unsigned leaf, unsigned subleaf) {
+    CpuidRegisters r = { 0, 0, 0, 0 };
+#if defined(_MSC_VER)
+    int registers[4];
+    __cpuidex(registers, (int)leaf, (int)subleaf);
+    r.eax = registers[0];
+    r.ebx = registers[1];
+    r.ecx = registers[2];
+    r.edx = registers[3];
+#else
+    __cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#endif
+    return r;
+  }
+
+  // the register state the OS saves on context switches (XCR0)
+  unsigned long long os_saved_state() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax, edx;
+    __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+  }
+
+  // The highest of the x86 tables the CPU and OS can run.
+  CpuIsa detect_isa() {
+    unsigned max_leaf = cpuid(0, 0).eax;
+    CpuidRegisters leaf1 = cpuid(1, 0);
+    if (!(leaf1.edx & (1u << 26))) {
+      return CPU_ISA_SCALAR;
+    }
+    bool osxsave = (leaf1.ecx & (1u << 27)) != 0;
+    bool avx = (leaf1.ecx & (1u << 28)) != 0;
+    bool fma = (leaf1.ecx & (1u << 12)) != 0;
+    if (max_leaf < 7 || !osxsave || !avx || !fma) {
+      return CPU_ISA_SSE2;
+    }
+    // xmm and ymm state, then opmask and both halves of zmm
+    unsigned long long state = os_saved_state();
+    CpuidRegisters leaf7 = cpuid(7, 0);
+    bool avx2 = (leaf7.ebx & (1u << 5)) != 0;
+    if (!avx2 || (state & 0x6) != 0x6) {
+      return CPU_ISA_SSE2;
+    }
+    bool avx512f = (leaf7.ebx & (1u << 16)) != 0;
+    if (!avx512f || (state & 0xe6) != 0xe6) {
+      return CPU_ISA_AVX2;
+    }
+    return CPU_ISA_AVX512;
+  }
+#endif
+
+  bool supported(CpuIsa isa) {
+    switch (isa) {
+    case CPU_ISA_SCALAR:
+      return true;
+#if defined(CPU_DISPATCH_X86)
+    case CPU_ISA_SSE2:
+    case CPU_ISA_AVX2:
+    case CPU_ISA_AVX512: {
+      static const CpuIsa detected = detect_isa();
+      return isa <= detected;
+    }
+#endif
+    case CPU_ISA_NEON:
+      // only built where the compiler targets it
+      return k_cpu_kernels_baseline.isa == CPU_ISA_NEON;
+    default:
+      return false;
+    }
+  }
+
+  const CpuKernels* best_table() {
+    for (size_t i = 0; i < k_table_count; ++i) {
+      if (supported(k_tables[i]->isa)) {
+        return k_tables[i];
+      }
+    }
+    return &k_cpu_kernels_scalar;
+  }
+}
+
+const CpuKernels& cpu_kernels() {
+  static const CpuKernels* const best = best_table();
+  return g_forced ? *g_forced : *best;
+}
+
+size_t cpu_kernel_table_count() {
+  return k_table_count;
+}
+
+const CpuKernels& cpu_kernel_table(size_t index) {
+  return *k_tables[index];
+}
+
+bool cpu_supports(CpuIsa isa) {
+  return supported(isa);
+}
+
+bool force_cpu_isa(const char* name) {
+  if (strcmp(name, "auto") == 0) {
+    g_forced = NULL;
+    return true;
+  }
+  for (size_t i = 0; i < k_table_count; ++i) {
+    if (strcmp(k_tables[i]->name, name) != 0) {
+      continue;
+    }
+    if (!supported(k_tables[i]->isa)) {
+      fprintf(stderr, "This CPU does not support %s\n", name);
+      return false;
+    }
+    g_forced = k_tables[i];
+    return true;
+  }
+  fprintf(stderr, "No %s kernels in this build; there are", name);
+  for (size_t i = 0; i < k_table_count; ++i) {
+    fprintf(stderr, " %s", k_tables[i]->name);
+  }
+  fprintf(stderr, "\n");
+  return false;
+}
@@ -0,0 +1,99 @@
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#include <stddef.h>
+#include "misc/kernels.h"
+
+// The hot loops with SIMD versions are built once per instruction set, from
+// misc/cpu_kernels.cxx, into tables of function pointers. The best table
+// the CPU supports is bound the first time cpu_kernels() is called, so one
+// binary runs everywhere from plain SSE2 to AVX-512, and force_cpu_isa()
+// binds another one for testing and benchmarking.
+//
+// Arrays of vec3f are passed as their floats, three per element, and
+// affine transforms as the top three rows of a row-major mat4f. Arrays of
+// quaternions are four floats per element, s then v, and arrays of mat4f
+// sixteen.
+
+enum CpuIsa {
+  CPU_ISA_SCALAR,
+  CPU_ISA_SSE2,
+  CPU_ISA_NEON,
+  CPU_ISA_AVX2,    // with FMA
+  CPU_ISA_AVX512,  // AVX-512F on top of AVX2
+};
+
+// A block of samples of a FieldGrid (see field_eval.h): columns
+// [x_begin, x_end) of rows [y_begin, y_end). field points at sample (0, 0)
+// and rows are width floats apart.
+struct FieldBlock {
+  const float* sources;  // source_count (x, y) pairs
+  size_t source_count;
+  float support_sq;
+  float origin[2];
+  float x_step[2];
+  float y_step[2];
+  size_t width;
+  size_t x_begin;
+  size_t x_end;
+  size_t y_begin;
+  size_t y_end;
+  float* field;
+};
+
+struct CpuKernels {
+  const char* name;  // "avx512", "avx2", "sse2", "neon" or "scalar"
+  CpuIsa isa;
+
+  // The products of vector_math.h. The mat4f and mat3f operators call the
+  // inline versions, which a call through the table would cost as much as.
+  void (*m4f_mul_m4fo)(const float* m, const float* n, float* result);
+  void (*m4f_mul_v4fo)(const float* m, const float* v, float* result);
+  void (*m3f_mul_m3fo)(const float* m, const float* n, float* result);
+
+  // count points through the affine transform m, for transform_points.
+  // out may be in.
+  void (*transform_points)(const float* m, const float* in, size_t count, float* out);
+  // The same, renormalising the results, for transform_normals.
+  void (*transform_normals)(const float* m, const float* in, size_t count, float* out);
+
+  // The face normals of Mesh::calculate_normals: the negated unit normal
+  // of each triangle of indexes.
+  void (*face_normals)(const float* vertexes, const unsigned* indexes,
+                       size_t face_count, float* out);
+
+  // The corners of the box around count points, which must not be zero.
+  void (*bounding_box)(const float* vertexes, size_t count,
+                       float* min_corner, float* max_corner);
+
+  // Sums one kernel of every source over a block, for evaluate_field.
+  void (*field_block[KERNEL_TYPE_COUNT])(const FieldBlock& block);
+
+  // The quaternion operations of misc/quaternion_batch.h, element by
+  // element. out may be an input, except for quaternions_to_mat4f.
+  void (*quaternions_to_mat4f)(const float* q, size_t count, float* out);
+  void (*compose_quaternions)(const float* lhs, const float* rhs, size_t count, float* out);
+  void (*nlerp_quaternions)(const float* from, const float* to, float t,
+                            size_t count, float* out);
+  void (*slerp_quaternions)(const float* from, const float* to, float t,
+                            size_t count, float* out);
+  void (*normalize_quaternions)(const float* q, size_t count, float* out);
+};
+
+// The bound table.
+const CpuKernels& cpu_kernels();
+
+// The tables built into this binary, best first. Not all of them need be
+// supported by the CPU.
+size_t cpu_kernel_table_count();
+const CpuKernels& cpu_kernel_table(size_t index);
+
+bool cpu_supports(CpuIsa isa);
+
+// Binds the table with the given name, or the best supported one for
+// "auto". Tables that are not built in or that the CPU does not support
+// are reported and refused. Not thread-safe: call it while nothing else is
+// using the kernels.
+bool force_cpu_isa(const char* name);
+
+#endif
@@ -0,0 +1,539 @@
+// The kernels behind the tables of misc/cpu_dispatch.h. CMake compiles this
+// file once per instruction set, each time with its own target flags and
+// with CPU_KERNELS_TABLE naming the table to define. The scalar build also
+// defines VECTOR_MATH_NO_SIMD.
+//
+// The math headers are included into an anonymous namespace, so that the
+// inline functions they define stay local to each build. Otherwise the
+// linker would keep one copy of each for the whole program, which might
+// be one with instructions the CPU lacks. The system headers they use are
+// included first, outside it.
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+#include "misc/cpu_dispatch.h"
+#include "misc/kernels.h"
+
+#if !defined(CPU_KERNELS_TABLE)
+#error "CPU_KERNELS_TABLE names the table that this build defines"
+#endif
+
+namespace {
+#include "math/vector_math.h"
+#include "math/floatx.h"
+#include "math/vec3f.h"
+#include "math/vec3f_x.h"
+#include "math/quaternion.h"
+#include "math/quaternion_x.h"
+
+  // The widest floatx in registers. Face normals stay at four lanes, where
+  // the wider ones lose more to gathering their corners than they gain.
+#if defined(FLOATX_AVX512)
+  const size_t k_width = 16;
+#elif defined(VECTOR_MATH_AVX)
+  const size_t k_width = 8;
+#elif defined(VECTOR_MATH_SSE) || defined(VECTOR_MATH_NEON)
+  const size_t k_width = 4;
+#else
+  const size_t k_width = 1;
+#endif
+  const size_t k_face_width = k_width < 4 ? k_width : 4;
+  // Quaternions stop at eight lanes, where moving them into and out of
+  // lanes already costs more than the arithmetic.
+  const size_t k_quaternion_width = k_width < 8 ? k_width : 8;
+
+  namespace transform {
+    template <bool Normalize>
+    inline void transform_one(const float* m, const float* p, float* out) {
+      float x = m[0]*p[0] + m[1]*p[1] + m[ 2]*p[2] + m[ 3];
+      float y = m[4]*p[0] + m[5]*p[1] + m[ 6]*p[2] + m[ 7];
+      float z = m[8]*p[0] + m[9]*p[1] + m[10]*p[2] + m[11];
+      out[0] = x;
+      out[1] = y;
+      out[2] = z;
+      if (Normalize) {
+        normalize_v3f(out);
+      }
+    }
+
+#if defined(VECTOR_MATH_AVX)
+    // The SSE code below on two groups of four points at once, one in each
+    // 128-bit half, which halves the shuffles per point.
+    const size_t k_lanes = 8;
+
+    typedef __m256 floatv;
+    inline floatv load(const float* p) {
+      return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)),
+        _mm_loadu_ps(p + 12), 1);
+    }
+    inline void store(float* p, floatv a) {
+      _mm_storeu_ps(p, _mm256_castps256_ps128(a));
+      _mm_storeu_ps(p + 12, _mm256_extractf128_ps(a, 1));
+    }
+    inline floatv splat(float x) { return _mm256_set1_ps(x); }
+    inline floatv add(floatv a, floatv b) { return _mm256_add_ps(a, b); }
+    inline floatv mul(floatv a, floatv b) { return _mm256_mul_ps(a, b); }
+    inline floatv div(floatv a, floatv b) { return _mm256_div_ps(a, b); }
+    inline floatv sqrt(floatv a) { return _mm256_sqrt_ps(a); }
+    inline floatv select_positive(floatv test, floatv a, floatv b) {
+      return _mm256_blendv_ps(b, a, _mm256_cmp_ps(test, _mm256_setzero_ps(), _CMP_GT_OQ));
+    }
+    #define MT_SHUFFLE(a, b, i0, i1, i2, i3) \
+      _mm256_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0))
+#elif defined(VECTOR_MATH_SSE)
+    const size_t k_lanes = 4;
+
+    typedef __m128 floatv;
+    inline floatv load(const float* p) { return _mm_loadu_ps(p); }
+    inline void store(float* p, floatv a) { _mm_storeu_ps(p, a); }
+    inline floatv splat(float x) { return _mm_set1_ps(x); }
+    inline floatv add(floatv a, floatv b) { return _mm_add_ps(a, b); }
+    inline floatv mul(floatv a, floatv b) { return _mm_mul_ps(a, b); }
+    inline floatv div(floatv a, floatv b) { return _mm_div_ps(a, b); }
+    inline floatv sqrt(floatv a) { return _mm_sqrt_ps(a); }
+    // a where test is above zero, otherwise b
+    inline floatv select_positive(floatv test, floatv a, floatv b) {
+      floatv mask = _mm_cmpgt_ps(test, _mm_setzero_ps());
+      return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+    // _mm_shuffle_ps with the lanes in reading order: a[i0] a[i1] b[i2] b[i3]
+    #define MT_SHUFFLE(a, b, i0, i1, i2, i3) \
+      _mm_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0))
+#endif
+
+#if defined(VECTOR_MATH_SSE)
+    // Four points from x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 into x, y
+    // and z registers, transformed, and back. With AVX the second half of
+    // each register holds the next four points.
+    template <bool Normalize>
+    inline void transform_lanes(const float* m, const float* p, float* out) {
+      floatv a = load(p);
+      floatv b = load(p + 4);
+      floatv c = load(p + 8);
+      floatv x = MT_SHUFFLE(a, MT_SHUFFLE(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+      floatv y = MT_SHUFFLE(MT_SHUFFLE(a, b, 1, 1, 0, 0), MT_SHUFFLE(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+      floatv z = MT_SHUFFLE(MT_SHUFFLE(a, b, 2, 2, 1, 1), MT_SHUFFLE(c, c, 0, 0, 3, 3), 0, 2, 0, 2);
+
+      floatv rx = add(add(mul(splat(m[0]), x), mul(splat(m[1]), y)),
+                      add(mul(splat(m[2]), z), splat(m[3])));
+      floatv ry = add(add(mul(splat(m[4]), x), mul(splat(m[5]), y)),
+                      add(mul(splat(m[6]), z), splat(m[7])));
+      floatv rz = add(add(mul(splat(m[8]), x), mul(splat(m[9]), y)),
+                      add(mul(splat(m[10]), z), splat(m[11])));
+
+      if (Normalize) {
+        floatv length_sq = add(add(mul(rx, rx), mul(ry, ry)), mul(rz, rz));
+        // zero vectors are left alone, as normalize_v3f does
+        floatv scale = select_positive(length_sq,
+          div(splat(1.f), sqrt(length_sq)), splat(1.f));
+        rx = mul(rx, scale);
+        ry = mul(ry, scale);
+        rz = mul(rz, scale);
+      }
+
+      store(out, MT_SHUFFLE(MT_SHUFFLE(rx, ry, 0, 0, 0, 0), MT_SHUFFLE(rz, rx, 0, 0, 1, 1), 0, 2, 0, 2));
+      store(out + 4, MT_SHUFFLE(MT_SHUFFLE(ry, rz, 1, 1, 1, 1), MT_SHUFFLE(rx, ry, 2, 2, 2, 2), 0, 2, 0, 2));
+      store(out + 8, MT_SHUFFLE(MT_SHUFFLE(rz, rx, 2, 2, 3, 3), MT_SHUFFLE(ry, rz, 3, 3, 3, 3), 0, 2, 0, 2));
+    }
+
+    #undef MT_SHUFFLE
+#elif defined(VECTOR_MATH_NEON)
+    const size_t k_lanes = 4;
+
+    template <bool Normalize>
+    inline void transform_lanes(const float* m, const float* p, float* out) {
+      float32x4x3_t v = vld3q_f32(p);
+      float32x4x3_t r;
+      for (int row = 0; row < 3; ++row) {
+        float32x4_t sum = vdupq_n_f32(m[4*row + 3]);
+        sum = vmlaq_n_f32(sum, v.val[0], m[4*row]);
+        sum = vmlaq_n_f32(sum, v.val[1], m[4*row + 1]);
+        sum = vmlaq_n_f32(sum, v.val[2], m[4*row + 2]);
+        r.val[row] = sum;
+      }
+      if (Normalize) {
+        float32x4_t length_sq = vmulq_f32(r.val[0], r.val[0]);
+        length_sq = vmlaq_f32(length_sq, r.val[1], r.val[1]);
+        length_sq = vmlaq_f32(length_sq, r.val[2], r.val[2]);
+        uint32x4_t nonzero = vcgtq_f32(length_sq, vdupq_n_f32(0));
+        float32x4_t scale = vdivq_f32(vdupq_n_f32(1), vsqrtq_f32(length_sq));
+        scale = vbslq_f32(nonzero, scale, vdupq_n_f32(1));
+        for (int row = 0; row < 3; ++row) {
+          r.val[row] = vmulq_f32(r.val[row], scale);
+        }
+      }
+      vst3q_f32(out, r);
+    }
+#else
+    const size_t k_lanes = 1;
+
+    template <bool Normalize>
+    inline void transform_lanes(const float* m, const float* p, float* out) {
+      transform_one<Normalize>(m, p, out);
+    }
+#endif
+
+#if defined(VECTOR_MATH_SSE) && !defined(VECTOR_MATH_AVX)
+    // With SSE alone the compiler vectorises the plain loop over points
+    // better than the shuffles do, but not the one over normals, which
+    // tests for zero lengths.
+    const bool k_shuffle_points = false;
+#else
+    const bool k_shuffle_points = true;
+#endif
+
+    template <bool Normalize>
+    void transform_affine(const float* affine, const float* in, size_t count, float* out) {
+      // a local copy, which the stores to out cannot alias, so that the
+      // matrix stays in registers
+      float m[12];
+      memcpy(m, affine, sizeof(m));
+      size_t i = 0;
+      if (Normalize || k_shuffle_points) {
+        for (; i + k_lanes <= count; i += k_lanes) {
+          transform_lanes<Normalize>(m, in + 3*i, out + 3*i);
+        }
+      }
+      for (; i < count; ++i) {
+        transform_one<Normalize>(m, in + 3*i, out + 3*i);
+      }
+    }
+  }
+
+  namespace mesh {
+    template <size_t N>
+    inline simd::vec3fx<N> gather_points(const float* vertexes, const int32_t* offsets) {
+      return simd::vec3fx<N>(simd::gather<N>(vertexes, offsets),
+                             simd::gather<N>(vertexes + 1, offsets),
+                             simd::gather<N>(vertexes + 2, offsets));
+    }
+
+    inline vec3f load_point(const float* vertexes, unsigned index) {
+      const float* p = vertexes + 3*index;
+      return vec3f(p[0], p[1], p[2]);
+    }
+
+    void face_normals(const float* vertexes, const unsigned* indexes,
+                      size_t face_count, float* out) {
+      const size_t N = k_face_width;
+      size_t f = 0;
+      for (; f + N <= face_count; f += N) {
+        int32_t offsets[3][N];
+        for (size_t k = 0; k < N; ++k) {
+          for (size_t c = 0; c < 3; ++c) {
+            offsets[c][k] = (int32_t)(3 * indexes[3*(f + k) + c]);
+          }
+        }
+        simd::vec3fx<N> a = gather_points<N>(vertexes, offsets[0]);
+        simd::vec3fx<N> b = gather_points<N>(vertexes, offsets[1]);
+        simd::vec3fx<N> c = gather_points<N>(vertexes, offsets[2]);
+        simd::vec3fx<N> normal = -normalized(cross(b - a, c - a));
+
+        float x[N], y[N], z[N];
+        simd::store(x, normal.x);
+        simd::store(y, normal.y);
+        simd::store(z, normal.z);
+        float* o = out + 3*f;
+        for (size_t k = 0; k < N; ++k) {
+          o[3*k] = x[k];
+          o[3*k + 1] = y[k];
+          o[3*k + 2] = z[k];
+        }
+      }
+      for (; f < face_count; ++f) {
+        vec3f a = load_point(vertexes, indexes[3*f]);
+        vec3f b = load_point(vertexes, indexes[3*f + 1]);
+        vec3f c = load_point(vertexes, indexes[3*f + 2]);
+        vec3f normal = -normalized(cross(b - a, c - a));
+        memcpy(out + 3*f, normal.data(), 3 * sizeof(float));
+      }
+    }
+
+    // N points are 3N floats, which load as three floatx<N> whose lanes
+    // always hold the same coordinates, so the running minimum and maximum
+    // of each register only need sorting by coordinate at the end.
+    void bounding_box(const float* vertexes, size_t count,
+                      float* min_corner, float* max_corner) {
+      const size_t N = k_width;
+      memcpy(min_corner, vertexes, 3 * sizeof(float));
+      memcpy(max_corner, vertexes, 3 * sizeof(float));
+      size_t i = 0;
+      if (count >= N) {
+        simd::floatx<N> lo[3], hi[3];
+        for (size_t k = 0; k < 3; ++k) {
+          lo[k] = hi[k] = simd::load<N>(vertexes + N*k);
+        }
+        for (i = N; i + N <= count; i += N) {
+          const float* p = vertexes + 3*i;
+          for (size_t k = 0; k < 3; ++k) {
+            simd::floatx<N> v = simd::load<N>(p + N*k);
+            lo[k] = simd::min(lo[k], v);
+            hi[k] = simd::max(hi[k], v);
+          }
+        }
+        float lo_lanes[3*N], hi_lanes[3*N];
+        for (size_t k = 0; k < 3; ++k) {
+          simd::store(lo_lanes + N*k, lo[k]);
+          simd::store(hi_lanes + N*k, hi[k]);
+        }
+        for (size_t j = 0; j < 3*N; ++j) {
+          min_corner[j % 3] = std::min(min_corner[j % 3], lo_lanes[j]);
+          max_corner[j % 3] = std::max(max_corner[j % 3], hi_lanes[j]);
+        }
+      }
+      for (; i < count; ++i) {
+        for (size_t c = 0; c < 3; ++c) {
+          min_corner[c] = std::min(min_corner[c], vertexes[3*i + c]);
+          max_corner[c] = std::max(max_corner[c], vertexes[3*i + c]);
+        }
+      }
+    }
+  }
+
+  namespace rotation {
+    // Whole groups of N quaternions at a time, then the rest one by one,
+    // which is all of them in the scalar build. Each group is loaded before
+    // anything of it is stored, so out may be an input.
+    const size_t N = k_quaternion_width;
+
+    inline const quaternion* quaternions(const float* q) {
+      return reinterpret_cast<const quaternion*>(q);
+    }
+    inline quaternion* quaternions(float* q) {
+      return reinterpret_cast<quaternion*>(q);
+    }
+
+    void to_mat4f(const float* q, size_t count, float* out) {
+      const quaternion* in = quaternions(q);
+      mat4f* m = reinterpret_cast<mat4f*>(out);
+      size_t i = 0;
+      for (; N > 1 && i + N <= count; i += N) {
+        simd::store_mat4f(m + i, simd::load<N>(in + i));
+      }
+      for (; i < count; ++i) {
+        m[i] = in[i].to_mat4f();
+      }
+    }
+
+    void compose(const float* lhs, const float* rhs, size_t count, float* out) {
+      const quaternion* l = quaternions(lhs);
+      const quaternion* r = quaternions(rhs);
+      quaternion* o = quaternions(out);
+      size_t i = 0;
+      for (; N > 1 && i + N <= count; i += N) {
+        simd::store(o + i, simd::load<N>(l + i) * simd::load<N>(r + i));
+      }
+      for (; i < count; ++i) {
+        o[i] = l[i] * r[i];
+      }
+    }
+
+    template <bool Spherical>
+    void interpolate(const float* from, const float* to, float t, size_t count, float* out) {
+      const quaternion* a = quaternions(from);
+      const quaternion* b = quaternions(to);
+      quaternion* o = quaternions(out);
+      const simd::floatx<N> tx = simd::splat<N>(t);
+      size_t i = 0;
+      for (; N > 1 && i + N <= count; i += N) {
+        simd::quaternionx<N> qa = simd::load<N>(a + i);
+        simd::quaternionx<N> qb = simd::load<N>(b + i);
+        simd::store(o + i, Spherical ? slerp(qa, qb, tx) : nlerp(qa, qb, tx));
+      }
+      for (; i < count; ++i) {
+        o[i] = Spherical ? slerp(a[i], b[i], t) : nlerp(a[i], b[i], t);
+      }
+    }
+
+    void normalize(const float* q, size_t count, float* out) {
+      const quaternion* in = quaternions(q);
+      quaternion* o = quaternions(out);
+      size_t i = 0;
+      for (; N > 1 && i + N <= count; i += N) {
+        simd::store(o + i, normalized(simd::load<N>(in + i)));
+      }
+      for (; i < count; ++i) {
+        o[i] = normalized(in[i]);
+      }
+    }
+  }
+
+  // e^x for x in [-87, 88], to within a couple of ulp. Splits x into
+  // n ln 2 + r and evaluates the Cephes polynomial for e^r.
+  template <size_t N>
+  inline simd::floatx<N> field_exp(simd::floatx<N> x) {
+    using simd::splat;
+    x = min(max(x, splat<N>(-87.f)), splat<N>(88.f));
+    simd::floatx<N> n = round(x * splat<N>(1.44269504088896341f));
+    simd::floatx<N> r = x - n * splat<N>(0.693359375f) - n * splat<N>(-2.12194440e-4f);
+    simd::floatx<N> p = splat<N>(1.9875691500e-4f);
+    p = p * r + splat<N>(1.3981999507e-3f);
+    p = p * r + splat<N>(8.3334519073e-3f);
+    p = p * r + splat<N>(4.1665795894e-2f);
+    p = p * r + splat<N>(1.6666665459e-1f);
+    p = p * r + splat<N>(5.0000001201e-1f);
+    p = p * r * r + r + splat<N>(1.f);
+    return p * exp2i(n);
+  }
+
+  // The kernels of misc/kernels.h without branches, N samples at a time.
+  // Each is zero at and beyond its support, as the scalar versions are.
+  template <size_t N>
+  struct FieldPoly6 {
+    static simd::floatx<N> value(simd::floatx<N> distance_sq) {
+      using simd::splat;
+      simd::floatx<N> x = max(splat<N>(kernel::h_sq) - distance_sq, splat<N>(0.f));
+      return splat<N>(kernel::poly6_norm) * x*x*x;
+    }
+  };
+
+  template <size_t N>
+  struct FieldSpiky {
+    static simd::floatx<N> value(simd::floatx<N> distance_sq) {
+      using simd::splat;
+      simd::floatx<N> x = max(splat<N>(kernel::h) - sqrt(distance_sq), splat<N>(0.f));
+      return splat<N>(kernel::spiky_norm) * x*x*x;
+    }
+  };
+
+  template <size_t N>
+  struct FieldViscosity {
+    static simd::floatx<N> value(simd::floatx<N> distance_sq) {
+      using simd::splat;
+      const float h = kernel::h;
+      const float h_sq = kernel::h_sq;
+      simd::floatx<N> r = max(sqrt(distance_sq), splat<N>(kernel::viscosity_min_r));
+      simd::floatx<N> v = splat<N>(-1.f / (2.f*h*h_sq)) * r*r*r
+        + splat<N>(1.f / h_sq) * r*r
+        + splat<N>(h / 2.f) / r
+        - splat<N>(1.f);
+      return select(distance_sq < splat<N>(h_sq),
+        splat<N>(kernel::viscosity_norm) * v, splat<N>(0.f));
+    }
+  };
+
+  template <size_t N>
+  struct FieldCubicSpline {
+    static simd::floatx<N> value(simd::floatx<N> distance_sq) {
+      using simd::splat;
+      simd::floatx<N> q = sqrt(distance_sq) * splat<N>(1.f / kernel::cubic_spline_hs);
+      simd::floatx<N> inner = splat<N>(1.f) - splat<N>(1.5f)*q*q + splat<N>(0.75f)*q*q*q;
+      simd::floatx<N> x = max(splat<N>(2.f) - q, splat<N>(0.f));
+      simd::floatx<N> outer = splat<N>(0.25f) * x*x*x;
+      return splat<N>(kernel::cubic_spline_norm) * select(q < splat<N>(1.f), inner, outer);
+    }
+  };
+
+  template <size_t N>
+  struct FieldGaussian {
+    static simd::floatx<N> value(simd::floatx<N> distance_sq) {
+      using simd::splat;
+      simd::floatx<N> v = splat<N>(kernel::gaussian_norm)
+        * field_exp(distance_sq * splat<N>(-1.f / (2.f * kernel::sigma_sq)));
+      return select(distance_sq <= splat<N>(kernel::gaussian_cutoff_sq), v, splat<N>(0.f));
+    }
+  };
+
+  // k_width samples of a row at a time, which is one in the scalar build.
+  template <template <size_t> class Kernel>
+  void field_block(const FieldBlock& block) {
+    using simd::splat;
+    const size_t N = k_width;
+    typedef simd::floatx<N> floatv;
+    float offsets[N];
+    for (size_t i = 0; i < N; ++i) {
+      offsets[i] = (float)i;
+    }
+    const floatv lane_offsets = simd::load<N>(offsets);
+    for (size_t y = block.y_begin; y < block.y_end; ++y) {
+      float row_x = block.origin[0] + block.y_step[0] * y;
+      float row_y = block.origin[1] + block.y_step[1] * y;
+      float* row = block.field + y * block.width;
+
+      for (size_t x = block.x_begin; x < block.x_end; x += N) {
+        floatv column = splat<N>((float)x) + lane_offsets;
+        floatv px = splat<N>(row_x) + splat<N>(block.x_step[0]) * column;
+        floatv py = splat<N>(row_y) + splat<N>(block.x_step[1]) * column;
+
+        // the box around these samples, to skip the sources out of reach
+        size_t last = std::min(x + N, block.x_end) - 1;
+        float lo[2], hi[2];
+        for (int axis = 0; axis < 2; ++axis) {
+          float start = axis == 0 ? row_x : row_y;
+          float a = start + block.x_step[axis] * x;
+          float b = start + block.x_step[axis] * last;
+          lo[axis] = std::min(a, b);
+          hi[axis] = std::max(a, b);
+        }
+
+        floatv sum = splat<N>(0.f);
+        for (size_t i = 0; i < block.source_count; ++i) {
+          float sx = block.sources[2*i];
+          float sy = block.sources[2*i + 1];
+          float gap_x = std::max(std::max(lo[0] - sx, sx - hi[0]), 0.f);
+          float gap_y = std::max(std::max(lo[1] - sy, sy - hi[1]), 0.f);
+          if (gap_x*gap_x + gap_y*gap_y > block.support_sq) {
+            continue;
+          }
+          floatv dx = px - splat<N>(sx);
+          floatv dy = py - splat<N>(sy);
+          sum = sum + Kernel<N>::value(dx*dx + dy*dy);
+        }
+
+        if (x + N <= block.x_end) {
+          simd::store(row + x, sum);
+        } else {
+          float lanes[N];
+          simd::store(lanes, sum);
+          memcpy(row + x, lanes, (block.x_end - x) * sizeof(float));
+        }
+      }
+    }
+  }
+}
+
+extern const CpuKernels CPU_KERNELS_TABLE;
+const CpuKernels CPU_KERNELS_TABLE = {
+#if defined(FLOATX_AVX512) && defined(__AVX2__)
+  "avx512", CPU_ISA_AVX512,
+#elif defined(VECTOR_MATH_AVX) && defined(__AVX2__)
+  "avx2", CPU_ISA_AVX2,
+#elif defined(VECTOR_MATH_SSE)
+  "sse2", CPU_ISA_SSE2,
+#elif defined(VECTOR_MATH_NEON)
+  "neon", CPU_ISA_NEON,
+#else
+  "scalar", CPU_ISA_SCALAR,
+#endif
+  m4f_mul_m4fo,
+  m4f_mul_v4fo,
+  m3f_mul_m3fo,
+  transform::transform_affine<false>,
+  transform::transform_affine<true>,
+  mesh::face_normals,
+  mesh::bounding_box,
+  {
+    field_block<FieldPoly6>,
+    field_block<FieldSpiky>,
+    field_block<FieldViscosity>,
+    field_block<FieldCubicSpline>,
+    field_block<FieldGaussian>,
+  },
+  rotation::to_mat4f,
+  rotation::compose,
+  rotation::interpolate<false>,
+  rotation::interpolate<true>,
+  rotation::normalize,
+};
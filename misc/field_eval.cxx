@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#include "misc/cpu_dispatch.h"
+#include "misc/field_eval.h"
+#include "misc/thread_pool.h"
+#include "misc/trace.h"
+
+namespace {
+  // Tiles are sized so that a tile of output and its sources stay in L1.
+  const size_t k_tile_width = 64;
+  const size_t k_tile_height = 16;
+
+  struct FieldTask {
+    const float* sources;
+    size_t source_count;
+    float support_sq;
+    const FieldGrid* grid;
+    float* field;
+    size_t tiles_x;
+    void (*evaluate)(const FieldBlock& block);
+  };
+
+  // Keeps only the sources whose support reaches the box [lo, hi].
+  void cull_sources(const FieldTask& task, const float* lo, const float* hi,
+      std::vector<float>* kept) {
+    kept->clear();
+    for (size_t i = 0; i < task.source_count; ++i) {
+      const float* s = task.sources + 2*i;
+      float dx = std::max(std::max(lo[0] - s[0], s[0] - hi[0]), 0.f);
+      float dy = std::max(std::max(lo[1] - s[1], s[1] - hi[1]), 0.f);
+      if (dx*dx + dy*dy <= task.support_sq) {
+        kept->push_back(s[0]);
+        kept->push_back(s[1]);
+      }
+    }
+  }
+
+  void evaluate_tile(void* context, size_t index) {
+    TRACE_ZONE("evaluate_tile");
+    const FieldTask& task = *(const FieldTask*)context;
+    const FieldGrid& grid = *task.grid;
+
+    FieldBlock block;
+    block.x_begin = (index % task.tiles_x) * k_tile_width;
+    block.y_begin = (index / task.tiles_x) * k_tile_height;
+    block.x_end = std::min(block.x_begin + k_tile_width, grid.width);
+    block.y_end = std::min(block.y_begin + k_tile_height, grid.height);
+
+    // the box around the tile's four corners
+    float lo[2], hi[2];
+    for (int axis = 0; axis < 2; ++axis) {
+      float x0 = grid.x_step[axis] * block.x_begin;
+      float x1 = grid.x_step[axis] * (block.x_end - 1);
+      float y0 = grid.y_step[axis] * block.y_begin;
+      float y1 = grid.y_step[axis] * (block.y_end - 1);
+      lo[axis] = grid.origin[axis] + std::min(x0, x1) + std::min(y0, y1);
+      hi[axis] = grid.origin[axis] + std::max(x0, x1) + std::max(y0, y1);
+    }
+    std::vector<float> sources;
+    sources.reserve(2 * task.source_count);
+    cull_sources(task, lo, hi, &sources);
+
+    block.sources = sources.data();
+    block.source_count = sources.size() / 2;
+    block.support_sq = task.support_sq;
+    for (int axis = 0; axis < 2; ++axis) {
+      block.origin[axis] = grid.origin[axis];
+      block.x_step[axis] = grid.x_step[axis];
+      block.y_step[axis] = grid.y_step[axis];
+    }
+    block.width = grid.width;
+    block.field = task.field;
+    task.evaluate(block);
+  }
+
+  struct ColormapTask {
+    const unsigned char* texels;
+    const float* field;
+    size_t count;
+    float range_min;
+    float scale;
+    unsigned char* out;
+  };
+
+  const size_t k_colormap_chunk = 4096;
+
+  void colormap_chunk(void* context, size_t index) {
+    const ColormapTask& task = *(const ColormapTask*)context;
+    size_t begin = index * k_colormap_chunk;
+    size_t end = std::min(begin + k_colormap_chunk, task.count);
+    const float last = (float)(k_colormap_width - 1);
+
+    for (size_t i = begin; i < end; ++i) {
+      // texel centres sit at (j + 0.5) / width, clamped to the edge texels
+      float t = (task.field[i] - task.range_min) * task.scale;
+      t = std::min(std::max(t, 0.f), 1.f);
+      float u = std::min(std::max(t * k_colormap_width - 0.5f, 0.f), last);
+      size_t j = std::min((size_t)u, k_colormap_width - 2);
+      float f = u - j;
+
+      const unsigned char* a = task.texels + 4*j;
+      const unsigned char* b = a + 4;
+      unsigned char* out = task.out + 4*i;
+      for (int c = 0; c < 4; ++c) {
+        out[c] = (unsigned char)(a[c] + f * (b[c] - a[c]) + 0.5f);
+      }
+    }
+  }
+
+  const unsigned char* packed_colormaps() {
+    static std::vector<unsigned char> texels;
+    static std::once_flag packed;
+    std::call_once(packed, [] {
+      texels.resize(4 * k_colormap_width * COLORMAP_COUNT);
+      pack_colormaps_rgba8(texels.data());
+    });
+    return texels.data();
+  }
+}
+
+void evaluate_field(KernelType type,
+                    const float* sources, size_t source_count,
+                    const FieldGrid& grid, float* field,
+                    ThreadPool* pool) {
+  if ((size_t)type >= KERNEL_TYPE_COUNT) {
+    return;
+  }
+
+  FieldTask task;
+  task.sources = sources;
+  task.source_count = source_count;
+  task.support_sq = k_kernels[type].support * k_kernels[type].support;
+  task.grid = &grid;
+  task.field = field;
+  task.tiles_x = (grid.width + k_tile_width - 1) / k_tile_width;
+  size_t tiles_y = (grid.height + k_tile_height - 1) / k_tile_height;
+  size_t tile_count = task.tiles_x * tiles_y;
+  task.evaluate = cpu_kernels().field_block[type];
+
+  run_chunks(pool, evaluate_tile, &task, tile_count, 1);
+}
+
+void colormap_field_rgba8(ColormapId id,
+                          const float* field, size_t count,
+                          float range_min, float range_max,
+                          unsigned char* out,
+                          ThreadPool* pool) {
+  ColormapTask task;
+  task.texels = packed_colormaps() + 4 * k_colormap_width * id;
+  task.field = field;
+  task.count = count;
+  task.range_min = range_min;
+  task.scale = range_max > range_min ? 1.f / (range_max - range_min) : 0.f;
+  task.out = out;
+  run_chunks(pool, colormap_chunk, &task, count, k_colormap_chunk);
+}
+
+const char* field_eval_isa() {
+  return cpu_kernels().name;
+}
@@ -0,0 +1,52 @@
+#ifndef FIELD_EVAL_H
+#define FIELD_EVAL_H
+
+#include <stddef.h>
+#include "misc/colormap.h"
+#include "misc/kernels.h"
+
+class ThreadPool;
+
+// CPU version of the field drawn by gradient.frag, for machines without a
+// GPU and as a reference for the shaders. The kernels have the same
+// support, normalisation and cut-offs as the GLSL ones, and sources are
+// summed in the same order.
+//
+// The inner loops run through cpu_kernels() (see cpu_dispatch.h), with
+// AVX2 where the CPU has it, SSE2 otherwise on x86, and in plain C++
+// elsewhere.
+
+// A regular grid of sample positions in field space. Sample (x, y) is at
+// origin + x * x_step + y * y_step, so the grid may be rotated, sheared or
+// flipped, as a view of the field through any camera is.
+struct FieldGrid {
+  float origin[2];  // position of sample (0, 0)
+  float x_step[2];  // offset from sample (x, y) to (x + 1, y)
+  float y_step[2];  // offset from sample (x, y) to (x, y + 1)
+  size_t width;
+  size_t height;
+};
+
+// Sums the kernel of every source at every sample of the grid. sources holds
+// source_count (x, y) pairs. field is row-major and must hold
+// width * height floats. The grid is split into tiles that are shared
+// across the pool, which may be NULL to run on the calling thread.
+void evaluate_field(KernelType type,
+                    const float* sources, size_t source_count,
+                    const FieldGrid& grid, float* field,
+                    ThreadPool* pool);
+
+// Maps count field values onto a colormap as RGBA8. range_min and range_max
+// map to the ends of the colormap. The lookup interpolates between texels
+// of the packed RGBA8 colormap with clamping at the ends, as the sampler
+// in the shaders does. out must hold 4 * count bytes.
+void colormap_field_rgba8(ColormapId id,
+                          const float* field, size_t count,
+                          float range_min, float range_max,
+                          unsigned char* out,
+                          ThreadPool* pool);
+
+// the name of the bound cpu_kernels() table
+const char* field_eval_isa();
+
+#endif
@@ -0,0 +1,34 @@
+#include <stdio.h>
+#include <vector>
+#include "misc/image_io.h"
+
+bool write_ppm_rgba8(const char* filename, size_t width, size_t height,
+                     const unsigned char* rgba) {
+  FILE* file = fopen(filename, "wb");
+  if (!file) {
+    fprintf(stderr, "Could not open %s for writing\n", filename);
+    return false;
+  }
+
+  fprintf(file, "P6\n%zu %zu\n255\n", width, height);
+  std::vector<unsigned char> row(3 * width);
+  bool ok = true;
+  for (size_t y = height; y-- > 0;) {
+    const unsigned char* src = rgba + 4 * width * y;
+    for (size_t x = 0; x < width; ++x) {
+      row[3*x + 0] = src[4*x + 0];
+      row[3*x + 1] = src[4*x + 1];
+      row[3*x + 2] = src[4*x + 2];
+    }
+    if (fwrite(row.data(), 1, row.size(), file) != row.size()) {
+      ok = false;
+      break;
+    }
+  }
+
+  if (fclose(file) != 0 || !ok) {
+    fprintf(stderr, "Could not write %s\n", filename);
+    return false;
+  }
+  return true;
+}
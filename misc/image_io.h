@@ -0,0 +1,11 @@
+#ifndef IMAGE_IO_H
+#define IMAGE_IO_H
+
+#include <stddef.h>
+
+// Writes a binary PPM from RGBA8 pixels, dropping alpha. Rows are taken
+// bottom-up, as glReadPixels returns them, so the file is the right way up.
+bool write_ppm_rgba8(const char* filename, size_t width, size_t height,
+                     const unsigned char* rgba);
+
+#endif
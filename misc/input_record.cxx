@@ -0,0 +1,181 @@
+#include <string.h>
+#include "misc/input_record.h"
+
+namespace {
+  const char k_magic[8] = { 'G', 'R', 'A', 'D', 'I', 'N', 'P', 'T' };
+  const uint32_t k_version = 2;
+
+  // payload layout per type: ints stored as i32, reals as f64
+  const size_t k_int_counts[INPUT_EVENT_TYPE_COUNT] = { 4, 3, 0, 0, 2 };
+  const size_t k_real_counts[INPUT_EVENT_TYPE_COUNT] = { 0, 0, 2, 2, 0 };
+
+  void put_u32(unsigned char* out, uint32_t value) {
+    for (size_t i = 0; i < 4; ++i) {
+      out[i] = (unsigned char)(value >> (8 * i));
+    }
+  }
+
+  uint32_t get_u32(const unsigned char* in) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      value |= (uint32_t)in[i] << (8 * i);
+    }
+    return value;
+  }
+
+  void put_u64(unsigned char* out, uint64_t value) {
+    put_u32(out, (uint32_t)value);
+    put_u32(out + 4, (uint32_t)(value >> 32));
+  }
+
+  uint64_t get_u64(const unsigned char* in) {
+    return get_u32(in) | (uint64_t)get_u32(in + 4) << 32;
+  }
+
+  void put_f64(unsigned char* out, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put_u64(out, bits);
+  }
+
+  double get_f64(const unsigned char* in) {
+    uint64_t bits = get_u64(in);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // u32 frame, u64 time and u8 type
+  const size_t k_event_header_size = 13;
+  const size_t k_max_payload_size = 32;
+}
+
+size_t input_event_payload_size(InputEventType type) {
+  return 4 * k_int_counts[type] + 8 * k_real_counts[type];
+}
+
+bool InputRecorder::open(const char* filename) {
+  close();
+  file_ = fopen(filename, "wb");
+  if (!file_) {
+    fprintf(stderr, "Could not open %s for writing\n", filename);
+    return false;
+  }
+  filename_ = filename;
+  unsigned char version[4];
+  put_u32(version, k_version);
+  fwrite(k_magic, 1, sizeof(k_magic), file_);
+  fwrite(version, 1, sizeof(version), file_);
+  return true;
+}
+
+void InputRecorder::close() {
+  if (!file_) {
+    return;
+  }
+  if (fclose(file_) != 0) {
+    fprintf(stderr, "Could not write %s\n", filename_);
+  }
+  file_ = NULL;
+}
+
+void InputRecorder::record(const InputEvent& event) {
+  if (!file_) {
+    return;
+  }
+  unsigned char bytes[k_event_header_size + k_max_payload_size];
+  put_u32(bytes, event.frame);
+  put_u64(bytes + 4, event.time_us);
+  bytes[12] = (unsigned char)event.type;
+  unsigned char* payload = bytes + k_event_header_size;
+  for (size_t i = 0; i < k_int_counts[event.type]; ++i) {
+    put_u32(payload, (uint32_t)event.ints[i]);
+    payload += 4;
+  }
+  for (size_t i = 0; i < k_real_counts[event.type]; ++i) {
+    put_f64(payload, event.reals[i]);
+    payload += 8;
+  }
+  fwrite(bytes, 1, payload - bytes, file_);
+}
+
+bool InputReplay::load(const char* filename) {
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    fprintf(stderr, "Could not open input recording: %s\n", filename);
+    return false;
+  }
+
+  events_.clear();
+  next_ = 0;
+  unsigned char header[sizeof(k_magic) + 4];
+  if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+      memcmp(header, k_magic, sizeof(k_magic)) != 0 ||
+      get_u32(header + sizeof(k_magic)) != k_version) {
+    fprintf(stderr, "%s is not an input recording of version %u\n",
+      filename, k_version);
+    fclose(file);
+    return false;
+  }
+
+  bool ok = true;
+  unsigned char bytes[k_event_header_size + k_max_payload_size];
+  for (;;) {
+    size_t header_read = fread(bytes, 1, k_event_header_size, file);
+    if (header_read != k_event_header_size) {
+      if (header_read != 0) {
+        fprintf(stderr, "%s: truncated after %zu events\n", filename, events_.size());
+        ok = false;
+      }
+      break;
+    }
+    InputEvent event;
+    memset(&event, 0, sizeof(event));
+    event.frame = get_u32(bytes);
+    event.time_us = get_u64(bytes + 4);
+    unsigned char type = bytes[12];
+    if (type >= INPUT_EVENT_TYPE_COUNT) {
+      fprintf(stderr, "%s: unknown event type %u after %zu events\n",
+        filename, type, events_.size());
+      ok = false;
+      break;
+    }
+    event.type = InputEventType(type);
+
+    size_t payload_size = input_event_payload_size(event.type);
+    const unsigned char* payload = bytes + k_event_header_size;
+    if (fread(bytes + k_event_header_size, 1, payload_size, file) != payload_size) {
+      fprintf(stderr, "%s: truncated after %zu events\n", filename, events_.size());
+      ok = false;
+      break;
+    }
+    for (size_t i = 0; i < k_int_counts[event.type]; ++i) {
+      event.ints[i] = (int32_t)get_u32(payload);
+      payload += 4;
+    }
+    for (size_t i = 0; i < k_real_counts[event.type]; ++i) {
+      event.reals[i] = get_f64(payload);
+      payload += 8;
+    }
+    events_.push_back(event);
+  }
+  fclose(file);
+  return ok;
+}
+
+bool InputReplay::next(ReplayPace pace, uint32_t frame, uint64_t time_us,
+                       InputEvent* event) {
+  if (done()) {
+    return false;
+  }
+  const InputEvent& candidate = events_[next_];
+  bool due = pace == REPLAY_BY_FRAME
+    ? candidate.frame <= frame
+    : candidate.time_us <= time_us;
+  if (!due) {
+    return false;
+  }
+  *event = candidate;
+  ++next_;
+  return true;
+}
@@ -0,0 +1,100 @@
+#ifndef INPUT_RECORD_H
+#define INPUT_RECORD_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+// Window input captured for replay, so the same session can be timed
+// across builds and machines.
+//
+// Each event carries the frame it arrived in and the time since recording
+// started. Replaying by frame feeds every event in the same frame it was
+// recorded in, whatever the frame rate. Replaying at the original pace
+// feeds events when their time comes round again.
+//
+// The file is an 8-byte "GRADINPT" magic and a little-endian u32 version,
+// then one record per event: u32 frame, u64 microseconds, u8 type, and the
+// payload for that type (see input_event_payload_size).
+
+enum InputEventType {
+  INPUT_KEY,           // ints: key, scancode, action, mods
+  INPUT_MOUSE_BUTTON,  // ints: button, action, mods
+  INPUT_MOUSE_MOVE,    // reals: x, y
+  INPUT_SCROLL,        // reals: x offset, y offset
+  INPUT_WINDOW_SIZE,   // ints: width, height
+  INPUT_EVENT_TYPE_COUNT,
+};
+
+struct InputEvent {
+  uint32_t frame;
+  uint64_t time_us;
+  InputEventType type;
+  int32_t ints[4];
+  double reals[2];
+};
+
+enum ReplayPace {
+  REPLAY_BY_FRAME,
+  REPLAY_ORIGINAL,
+};
+
+// Bytes of payload after the type byte.
+size_t input_event_payload_size(InputEventType type);
+
+class InputRecorder {
+public:
+  InputRecorder();
+
+  bool open(const char* filename);
+  void close();
+  bool is_open() const;
+
+  void record(const InputEvent& event);
+
+private:
+  InputRecorder(const InputRecorder&);
+  InputRecorder& operator=(const InputRecorder&);
+
+  FILE* file_;
+  const char* filename_;
+};
+
+class InputReplay {
+public:
+  InputReplay();
+
+  bool load(const char* filename);
+
+  // Takes the next event due at the given frame or time, if any.
+  bool next(ReplayPace pace, uint32_t frame, uint64_t time_us, InputEvent* event);
+  bool done() const;
+  size_t event_count() const;
+
+private:
+  std::vector<InputEvent> events_;
+  size_t next_;
+};
+
+inline InputRecorder::InputRecorder()
+  : file_(NULL)
+  , filename_(NULL)
+{}
+
+inline bool InputRecorder::is_open() const {
+  return file_ != NULL;
+}
+
+inline InputReplay::InputReplay()
+  : next_(0)
+{}
+
+inline bool InputReplay::done() const {
+  return next_ >= events_.size();
+}
+
+inline size_t InputReplay::event_count() const {
+  return events_.size();
+}
+
+#endif
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+#include "misc/kernel_table.h"
+
+void bake_kernel_table(const KernelInfo& kernel, size_t resolution,
+  float* out) {
+  float max_distance_sq = kernel.support * kernel.support;
+  for (size_t i = 0; i < resolution; ++i) {
+    float distance_sq = i * max_distance_sq / (resolution - 1);
+    out[2*i] = kernel.value(distance_sq);
+    out[2*i + 1] = kernel.derivative(distance_sq);
+  }
+}
+
+void sample_kernel_table(const KernelInfo& kernel, const float* texels,
+  size_t resolution, float distance_sq, float* value, float* derivative) {
+  float max_distance_sq = kernel.support * kernel.support;
+  float x = distance_sq / max_distance_sq * (resolution - 1);
+  x = std::min(std::max(x, 0.f), float(resolution - 1));
+  size_t i = std::min(size_t(x), resolution - 2);
+  float t = x - i;
+  *value = (1 - t) * texels[2*i] + t * texels[2*i + 2];
+  *derivative = (1 - t) * texels[2*i + 1] + t * texels[2*i + 3];
+}
+
+KernelTableError measure_kernel_table_error(const KernelInfo& kernel,
+  const float* texels, size_t resolution, size_t sample_count) {
+  KernelTableError error = {0, 0, 0, 0};
+  float max_distance_sq = kernel.support * kernel.support;
+  for (size_t i = 0; i < sample_count; ++i) {
+    float distance_sq = i * max_distance_sq / (sample_count - 1);
+    float value, derivative;
+    sample_kernel_table(kernel, texels, resolution, distance_sq,
+      &value, &derivative);
+    float expected_value = kernel.value(distance_sq);
+    float expected_derivative = kernel.derivative(distance_sq);
+    error.value = std::max(error.value,
+      std::fabs(value - expected_value));
+    error.derivative = std::max(error.derivative,
+      std::fabs(derivative - expected_derivative));
+    error.value_peak = std::max(error.value_peak,
+      std::fabs(expected_value));
+    error.derivative_peak = std::max(error.derivative_peak,
+      std::fabs(expected_derivative));
+  }
+  return error;
+}
+
+void print_kernel_table_error(const KernelInfo& kernel, size_t resolution,
+  const KernelTableError& error) {
+  printf("Kernel table '%s' (%zu texels): "
+         "max error %g (%.3g%% of peak), derivative %g (%.3g%% of peak)\n",
+    kernel.name, resolution,
+    error.value, 100 * error.value / error.value_peak,
+    error.derivative, 100 * error.derivative / error.derivative_peak);
+}
@@ -0,0 +1,32 @@
+#ifndef KERNEL_TABLE_H
+#define KERNEL_TABLE_H
+
+#include <stddef.h>
+#include "misc/kernels.h"
+
+// A kernel and its derivative, tabulated over squared distance.
+// Texel i holds the value and the derivative at
+// distance_sq = i * support^2 / (resolution - 1).
+
+struct KernelTableError {
+  float value;       // max absolute error in the kernel
+  float derivative;  // max absolute error in the derivative
+  float value_peak;
+  float derivative_peak;
+};
+
+// writes 2 * resolution floats, interleaved value and derivative
+void bake_kernel_table(const KernelInfo& kernel, size_t resolution,
+  float* out);
+
+// mirrors a linearly filtered, edge-clamped texture lookup
+void sample_kernel_table(const KernelInfo& kernel, const float* texels,
+  size_t resolution, float distance_sq, float* value, float* derivative);
+
+KernelTableError measure_kernel_table_error(const KernelInfo& kernel,
+  const float* texels, size_t resolution, size_t sample_count);
+
+void print_kernel_table_error(const KernelInfo& kernel, size_t resolution,
+  const KernelTableError& error);
+
+#endif
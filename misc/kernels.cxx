@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include "math/vector_math.h"
+#include "misc/kernels.h"
+
+const KernelInfo k_kernels[KERNEL_TYPE_COUNT] = {
+  { "poly6", "KERNEL_POLY6", kernel::poly6, kernel::poly6_derivative,
+    kernel::h, kernel::poly6_norm },
+  { "spiky", "KERNEL_SPIKY", kernel::spiky, kernel::spiky_derivative,
+    kernel::h, kernel::spiky_norm },
+  { "viscosity", "KERNEL_VISCOSITY", kernel::viscosity, kernel::viscosity_derivative,
+    kernel::h, kernel::viscosity_norm },
+  { "cubic spline", "KERNEL_CUBIC_SPLINE", kernel::cubic_spline, kernel::cubic_spline_derivative,
+    kernel::h, kernel::cubic_spline_norm },
+  { "gaussian", "KERNEL_GAUSSIAN", kernel::gaussian, kernel::gaussian_derivative,
+    vector_math_sqrtf(kernel::gaussian_cutoff_sq), kernel::gaussian_norm },
+};
+
+int kernel_shader_defines(KernelType type, char* buffer, size_t size) {
+  const KernelInfo& info = k_kernels[type];
+  return snprintf(buffer, size,
+    "#define %s\n"
+    "#define K_H %.9e\n"
+    "#define K_NORM %.9e\n"
+    "#define K_SIGMA_SQ %.9e\n"
+    "#define K_VISCOSITY_MIN_R %.9e\n",
+    info.define, info.support, info.norm,
+    kernel::sigma_sq, kernel::viscosity_min_r);
+}
@@ -0,0 +1,144 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stddef.h>
+#include <algorithm>
+#include <cmath>
+
+// CPU versions of the kernels in shaders/kernel.glsl. The shader gets its
+// constants from here through the defines written by kernel_shader_defines,
+// so the two only need to agree on the formulas.
+//
+// Every kernel is 2D normalised and is zero at and beyond its support.
+// The derivatives are dW/dr; the gradient is the derivative times the
+// normalized offset from the source.
+namespace kernel {
+  constexpr float pi = 3.1415926535897932f;
+
+  constexpr float h = 1.5f;
+  constexpr float h_sq = h*h;
+
+  constexpr float poly6_norm = 4.f / (pi * (h_sq*h_sq*h_sq*h_sq));
+  constexpr float spiky_norm = 10.f / (pi * (h_sq*h_sq*h));
+  constexpr float viscosity_norm = 10.f / (3.f * pi * h_sq);
+  // the viscosity kernel is singular at the origin
+  constexpr float viscosity_min_r = 0.01f * h;
+  // support is twice the smoothing length
+  constexpr float cubic_spline_hs = h / 2.f;
+  constexpr float cubic_spline_norm = 10.f / (7.f * pi * cubic_spline_hs * cubic_spline_hs);
+
+  constexpr float sigma_sq = 0.25f;
+  constexpr float gaussian_cutoff_sq = 50.f * (2.f * sigma_sq);
+  constexpr float gaussian_norm = 1.f / (2.f * pi * sigma_sq);
+
+  inline float poly6(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float x = h_sq - distance_sq;
+    return poly6_norm * x*x*x;
+  }
+
+  inline float poly6_derivative(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float x = h_sq - distance_sq;
+    return -6.f * poly6_norm * std::sqrt(distance_sq) * x*x;
+  }
+
+  inline float spiky(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float x = h - std::sqrt(distance_sq);
+    return spiky_norm * x*x*x;
+  }
+
+  inline float spiky_derivative(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float x = h - std::sqrt(distance_sq);
+    return -3.f * spiky_norm * x*x;
+  }
+
+  inline float viscosity(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float r = std::max(std::sqrt(distance_sq), viscosity_min_r);
+    return viscosity_norm * (-r*r*r / (2.f*h*h_sq) + r*r / h_sq + h / (2.f*r) - 1.f);
+  }
+
+  inline float viscosity_derivative(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float r = std::max(std::sqrt(distance_sq), viscosity_min_r);
+    return viscosity_norm * (-3.f*r*r / (2.f*h*h_sq) + 2.f*r / h_sq - h / (2.f*r*r));
+  }
+
+  inline float cubic_spline(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float q = std::sqrt(distance_sq) / cubic_spline_hs;
+    if (q < 1.f) {
+      return cubic_spline_norm * (1.f - 1.5f*q*q + 0.75f*q*q*q);
+    }
+    float x = 2.f - q;
+    return cubic_spline_norm * 0.25f * x*x*x;
+  }
+
+  inline float cubic_spline_derivative(float distance_sq) {
+    if (distance_sq >= h_sq) {
+      return 0.f;
+    }
+    float q = std::sqrt(distance_sq) / cubic_spline_hs;
+    if (q < 1.f) {
+      return cubic_spline_norm / cubic_spline_hs * (-3.f*q + 2.25f*q*q);
+    }
+    float x = 2.f - q;
+    return cubic_spline_norm / cubic_spline_hs * -0.75f * x*x;
+  }
+
+  inline float gaussian(float distance_sq) {
+    if (distance_sq > gaussian_cutoff_sq) {
+      return 0.f;
+    }
+    return gaussian_norm * std::exp(-distance_sq / (2.f * sigma_sq));
+  }
+
+  inline float gaussian_derivative(float distance_sq) {
+    return -std::sqrt(distance_sq) / sigma_sq * gaussian(distance_sq);
+  }
+}
+
+enum KernelType {
+  KERNEL_POLY6,
+  KERNEL_SPIKY,
+  KERNEL_VISCOSITY,
+  KERNEL_CUBIC_SPLINE,
+  KERNEL_GAUSSIAN,
+  KERNEL_TYPE_COUNT,
+};
+
+typedef float (*KernelFunction)(float distance_sq);
+
+struct KernelInfo {
+  const char* name;
+  const char* define;
+  KernelFunction value;
+  KernelFunction derivative;
+  float support;
+  float norm;
+};
+
+extern const KernelInfo k_kernels[KERNEL_TYPE_COUNT];
+
+// Writes the #define block that specialises kernel.glsl for the given type.
+// Returns the length of the block, as snprintf does.
+int kernel_shader_defines(KernelType type, char* buffer, size_t size);
+
+#endif
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include "misc/cpu_dispatch.h"
+#include "misc/quaternion_batch.h"
+#include "misc/thread_pool.h"
+#include "misc/trace.h"
+
+// The kernels take quaternions as their four floats and matrices as their
+// sixteen.
+static_assert(sizeof(quaternion) == 4 * sizeof(float), "quaternion is s then v");
+static_assert(sizeof(mat4f) == 16 * sizeof(float), "mat4f is its elements");
+
+namespace {
+  enum BatchOp {
+    BATCH_TO_MAT4F,
+    BATCH_COMPOSE,
+    BATCH_NLERP,
+    BATCH_SLERP,
+    BATCH_NORMALIZE,
+  };
+
+  // rhs is unused by the operations of one array, and t by all but the
+  // interpolations.
+  struct BatchTask {
+    BatchOp op;
+    const float* lhs;
+    const float* rhs;
+    float t;
+    float* out;
+    size_t count;
+  };
+
+  const size_t k_batch_chunk = 16384;
+
+  void batch_chunk(void* context, size_t index) {
+    const BatchTask& task = *(const BatchTask*)context;
+    size_t begin = index * k_batch_chunk;
+    size_t count = std::min(begin + k_batch_chunk, task.count) - begin;
+    const float* lhs = task.lhs + 4*begin;
+    const float* rhs = task.rhs + 4*begin;
+    const CpuKernels& kernels = cpu_kernels();
+    switch (task.op) {
+    case BATCH_TO_MAT4F:
+      kernels.quaternions_to_mat4f(lhs, count, task.out + 16*begin);
+      break;
+    case BATCH_COMPOSE:
+      kernels.compose_quaternions(lhs, rhs, count, task.out + 4*begin);
+      break;
+    case BATCH_NLERP:
+      kernels.nlerp_quaternions(lhs, rhs, task.t, count, task.out + 4*begin);
+      break;
+    case BATCH_SLERP:
+      kernels.slerp_quaternions(lhs, rhs, task.t, count, task.out + 4*begin);
+      break;
+    case BATCH_NORMALIZE:
+      kernels.normalize_quaternions(lhs, count, task.out + 4*begin);
+      break;
+    }
+  }
+
+  void run_batch(BatchOp op, const quaternion* lhs, const quaternion* rhs, float t,
+                 float* out, size_t count, ThreadPool* pool) {
+    BatchTask task;
+    task.op = op;
+    task.lhs = reinterpret_cast<const float*>(lhs);
+    task.rhs = reinterpret_cast<const float*>(rhs ? rhs : lhs);
+    task.t = t;
+    task.out = out;
+    task.count = count;
+    run_chunks(pool, batch_chunk, &task, count, k_batch_chunk);
+  }
+}
+
+void quaternions_to_mat4f(const quaternion* q, size_t count, mat4f* out,
+                          ThreadPool* pool) {
+  TRACE_ZONE("quaternions_to_mat4f");
+  run_batch(BATCH_TO_MAT4F, q, NULL, 0, reinterpret_cast<float*>(out), count, pool);
+}
+
+void compose_quaternions(const quaternion* lhs, const quaternion* rhs, size_t count,
+                         quaternion* out, ThreadPool* pool) {
+  TRACE_ZONE("compose_quaternions");
+  run_batch(BATCH_COMPOSE, lhs, rhs, 0, reinterpret_cast<float*>(out), count, pool);
+}
+
+void nlerp_quaternions(const quaternion* from, const quaternion* to, float t,
+                       size_t count, quaternion* out, ThreadPool* pool) {
+  TRACE_ZONE("nlerp_quaternions");
+  run_batch(BATCH_NLERP, from, to, t, reinterpret_cast<float*>(out), count, pool);
+}
+
+void slerp_quaternions(const quaternion* from, const quaternion* to, float t,
+                       size_t count, quaternion* out, ThreadPool* pool) {
+  TRACE_ZONE("slerp_quaternions");
+  run_batch(BATCH_SLERP, from, to, t, reinterpret_cast<float*>(out), count, pool);
+}
+
+void normalize_quaternions(quaternion* q, size_t count, ThreadPool* pool) {
+  TRACE_ZONE("normalize_quaternions");
+  run_batch(BATCH_NORMALIZE, q, NULL, 0, reinterpret_cast<float*>(q), count, pool);
+}
@@ -0,0 +1,38 @@
+#ifndef QUATERNION_BATCH_H
+#define QUATERNION_BATCH_H
+
+#include <stddef.h>
+#include "math/mat4f.h"
+#include "math/quaternion.h"
+
+class ThreadPool;
+
+// The quaternion operations over whole arrays, element by element, for
+// animating many oriented instances at once. Quaternions are processed
+// several at a time in SIMD registers (see cpu_dispatch.h), and arrays
+// larger than a chunk are split across the pool, which may be NULL to run
+// on the calling thread.
+//
+// The quaternion outputs may be the same array as an input, but must not
+// otherwise overlap them.
+
+// quaternion::to_mat4f of each element
+void quaternions_to_mat4f(const quaternion* q, size_t count, mat4f* out,
+                          ThreadPool* pool);
+
+// out[i] = lhs[i] * rhs[i]
+void compose_quaternions(const quaternion* lhs, const quaternion* rhs, size_t count,
+                         quaternion* out, ThreadPool* pool);
+
+// nlerp and slerp (see quaternion.h) between two keyframes of every
+// element. The slerp is within about 1e-6 of the scalar one.
+void nlerp_quaternions(const quaternion* from, const quaternion* to, float t,
+                       size_t count, quaternion* out, ThreadPool* pool);
+void slerp_quaternions(const quaternion* from, const quaternion* to, float t,
+                       size_t count, quaternion* out, ThreadPool* pool);
+
+// Renormalises in place, as orientations updated by products need now and
+// then. Zero quaternions stay zero.
+void normalize_quaternions(quaternion* q, size_t count, ThreadPool* pool);
+
+#endif
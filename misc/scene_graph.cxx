@@ -0,0 +1,206 @@
+#include <algorithm>
+#include "misc/scene_graph.h"
+#include "misc/thread_pool.h"
+#include "misc/trace.h"
+
+namespace {
+  // Levels with fewer nodes than this run on the calling thread.
+  const size_t k_update_chunk = 2048;
+
+  template <typename T>
+  void permute(const std::vector<size_t>& order, std::vector<T>* values) {
+    std::vector<T> sorted(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+      sorted[i] = (*values)[order[i]];
+    }
+    values->swap(sorted);
+  }
+}
+
+mat4f LocalTransform::to_mat4f() const {
+  mat4f m = rotation.to_mat4f();
+  for (size_t row = 0; row < 3; ++row) {
+    for (size_t column = 0; column < 3; ++column) {
+      m[4*row + column] *= scale[column];
+    }
+    m[4*row + 3] = translation[row];
+  }
+  return m;
+}
+
+LocalTransform LocalTransform::identity() {
+  LocalTransform t = {
+    vec3f(0, 0, 0),
+    quaternion(1, vec3f(0, 0, 0)),
+    vec3f(1, 1, 1),
+  };
+  return t;
+}
+
+size_t SceneGraph::add_node(size_t parent, const LocalTransform& local) {
+  size_t id = id_of_.size();
+  size_t index = id;
+  index_of_.push_back(index);
+  id_of_.push_back(id);
+  parents_.push_back(parent == k_no_parent ? k_no_parent : index_of_[parent]);
+  children_begin_.push_back(0);
+  children_end_.push_back(0);
+  locals_.push_back(local);
+  worlds_.push_back(mat4f::identity());
+  dirty_.push_back(0);
+  updated_.push_back(0);
+  mark_dirty(index);
+  sorted_ = false;
+  return id;
+}
+
+void SceneGraph::set_local(size_t node, const LocalTransform& local) {
+  size_t index = index_of_[node];
+  locals_[index] = local;
+  mark_dirty(index);
+}
+
+void SceneGraph::mark_dirty(size_t index) {
+  if (!dirty_[index]) {
+    dirty_[index] = 1;
+    dirty_list_.push_back(index);
+  }
+}
+
+// Breadth first from the roots, taking the children of each node in the
+// order they were added.
+void SceneGraph::sort_nodes() {
+  TRACE_ZONE("SceneGraph::sort_nodes");
+  size_t count = node_count();
+
+  // the children of every node, and the roots under count: children of p
+  // are children[first[p]] up to children[first[p + 1]]
+  std::vector<size_t> first(count + 3, 0);
+  for (size_t i = 0; i < count; ++i) {
+    size_t p = parents_[i] == k_no_parent ? count : parents_[i];
+    ++first[p + 2];
+  }
+  for (size_t p = 2; p < count + 3; ++p) {
+    first[p] += first[p - 1];
+  }
+  std::vector<size_t> children(count);
+  for (size_t i = 0; i < count; ++i) {
+    size_t p = parents_[i] == k_no_parent ? count : parents_[i];
+    children[first[p + 1]++] = i;
+  }
+
+  // order[new index] = old index
+  std::vector<size_t> order(children.begin() + first[count], children.end());
+  order.reserve(count);
+  std::vector<size_t> begin(count), end(count);
+  for (size_t head = 0; head < order.size(); ++head) {
+    size_t old = order[head];
+    begin[head] = order.size();
+    order.insert(order.end(), children.begin() + first[old], children.begin() + first[old + 1]);
+    end[head] = order.size();
+  }
+
+  std::vector<size_t> new_index(count);
+  for (size_t i = 0; i < count; ++i) {
+    new_index[order[i]] = i;
+  }
+  permute(order, &parents_);
+  for (size_t i = 0; i < count; ++i) {
+    if (parents_[i] != k_no_parent) {
+      parents_[i] = new_index[parents_[i]];
+    }
+  }
+  children_begin_.swap(begin);
+  children_end_.swap(end);
+  permute(order, &locals_);
+  permute(order, &worlds_);
+  permute(order, &dirty_);
+  permute(order, &id_of_);
+  for (size_t i = 0; i < count; ++i) {
+    index_of_[id_of_[i]] = i;
+  }
+  std::fill(updated_.begin(), updated_.end(), 0u);
+
+  // a new level starts wherever the parent moves past the end of the
+  // level above
+  level_begin_.assign(1, 0);
+  for (size_t i = 0; i < count; ++i) {
+    if (parents_[i] != k_no_parent && parents_[i] >= level_begin_.back()) {
+      level_begin_.push_back(i);
+    }
+  }
+  level_begin_.push_back(count);
+  if (count == 0) {
+    level_begin_.assign(1, 0);
+  }
+
+  dirty_list_.clear();
+  for (size_t i = 0; i < count; ++i) {
+    if (dirty_[i]) {
+      dirty_list_.push_back(i);
+    }
+  }
+  sorted_ = true;
+}
+
+size_t SceneGraph::update(ThreadPool* pool) {
+  TRACE_ZONE("SceneGraph::update");
+  if (!sorted_) {
+    sort_nodes();
+  }
+  if (dirty_list_.empty()) {
+    return 0;
+  }
+  std::sort(dirty_list_.begin(), dirty_list_.end());
+  if (++stamp_ == 0) {
+    std::fill(updated_.begin(), updated_.end(), 0u);
+    stamp_ = 1;
+  }
+
+  size_t recomputed = 0;
+  size_t next_dirty = 0;
+  work_.clear();
+  for (size_t level = 0; level < level_count(); ++level) {
+    // the children of what moved in the level above, then the nodes of
+    // this level that were set and are not among them
+    next_work_.clear();
+    for (size_t k = 0; k < work_.size(); ++k) {
+      size_t i = work_[k];
+      for (size_t child = children_begin_[i]; child < children_end_[i]; ++child) {
+        next_work_.push_back(child);
+      }
+    }
+    for (; next_dirty < dirty_list_.size()
+           && dirty_list_[next_dirty] < level_begin_[level + 1]; ++next_dirty) {
+      size_t i = dirty_list_[next_dirty];
+      dirty_[i] = 0;
+      if (parents_[i] == k_no_parent || updated_[parents_[i]] != stamp_) {
+        next_work_.push_back(i);
+      }
+    }
+    work_.swap(next_work_);
+    if (work_.empty() && next_dirty == dirty_list_.size()) {
+      break;
+    }
+    run_chunks(pool, update_chunk, this, work_.size(), k_update_chunk);
+    recomputed += work_.size();
+  }
+  dirty_list_.clear();
+  return recomputed;
+}
+
+void SceneGraph::update_chunk(void* context, size_t chunk) {
+  SceneGraph& graph = *(SceneGraph*)context;
+  size_t begin = chunk * k_update_chunk;
+  size_t end = std::min(begin + k_update_chunk, graph.work_.size());
+  for (size_t k = begin; k < end; ++k) {
+    size_t i = graph.work_[k];
+    size_t parent = graph.parents_[i];
+    if (parent == k_no_parent) {
+      graph.worlds_[i] = graph.locals_[i].to_mat4f();
+    } else {
+      graph.worlds_[i] = graph.worlds_[parent] * graph.locals_[i].to_mat4f();
+    }
+    graph.updated_[i] = graph.stamp_;
+  }
+}
@@ -0,0 +1,126 @@
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "math/mat4f.h"
+#include "math/quaternion.h"
+#include "math/vec3f.h"
+
+class ThreadPool;
+
+// A node's transform relative to its parent: scale, then rotation, then
+// translation.
+struct LocalTransform {
+  vec3f translation;
+  quaternion rotation;
+  vec3f scale;
+
+  // trans(translation) * rotation.to_mat4f() * scale(scale)
+  mat4f to_mat4f() const;
+
+  static LocalTransform identity();
+};
+
+// A transform hierarchy whose world matrices are cached and only recomputed
+// below the nodes whose local transforms changed.
+//
+// Nodes are stored in flat arrays in breadth-first order, so every level is
+// a contiguous range that comes after the one above it, and the children of
+// a node are a contiguous range of the next level. update() walks the
+// levels top down, each one from the list of nodes that changed in the one
+// above plus those set since the last update, and splits the matrices of a
+// level across the pool. Its cost follows the number of nodes that move,
+// not the size of the scene.
+//
+// Nodes are named by the ids add_node() returns, which stay the same as
+// nodes are added. Adding nodes re-sorts the arrays at the next update().
+class SceneGraph {
+public:
+  static constexpr size_t k_no_parent = (size_t)-1;
+
+  SceneGraph();
+
+  // A new node under parent, or a root for k_no_parent. Its world matrix
+  // is computed by the next update().
+  size_t add_node(size_t parent, const LocalTransform& local);
+  void set_local(size_t node, const LocalTransform& local);
+
+  const LocalTransform& local(size_t node) const;
+  // as of the last update()
+  const mat4f& world(size_t node) const;
+  size_t parent(size_t node) const;
+
+  size_t node_count() const;
+  // the depth of the deepest node plus one, as of the last update()
+  size_t level_count() const;
+
+  // Recomputes the world matrices of the changed nodes and their
+  // descendants, a level at a time, with pool (which may be NULL) sharing
+  // out the large levels. Returns how many were recomputed.
+  size_t update(ThreadPool* pool);
+
+private:
+  void sort_nodes();
+  void mark_dirty(size_t index);
+  static void update_chunk(void* context, size_t chunk);
+
+private:
+  // indexes into the arrays below, by id, and back
+  std::vector<size_t> index_of_;
+  std::vector<size_t> id_of_;
+
+  // by index; parents_ holds indexes too, and the children of node i are
+  // the indexes [children_begin_[i], children_end_[i])
+  std::vector<size_t> parents_;
+  std::vector<size_t> children_begin_;
+  std::vector<size_t> children_end_;
+  std::vector<LocalTransform> locals_;
+  std::vector<mat4f> worlds_;
+  std::vector<uint8_t> dirty_;
+  // the update() in which each world matrix was last recomputed
+  std::vector<unsigned> updated_;
+
+  // the first index of every level, then node_count()
+  std::vector<size_t> level_begin_;
+  // false from add_node() until the arrays are sorted again
+  bool sorted_;
+
+  // indexes set since the last update, each once
+  std::vector<size_t> dirty_list_;
+  unsigned stamp_;
+
+  // the indexes recomputed in the current and next level of update()
+  std::vector<size_t> work_;
+  std::vector<size_t> next_work_;
+};
+
+inline SceneGraph::SceneGraph()
+  : level_begin_(1, 0)
+  , sorted_(true)
+  , stamp_(0)
+{}
+
+inline const LocalTransform& SceneGraph::local(size_t node) const {
+  return locals_[index_of_[node]];
+}
+
+inline const mat4f& SceneGraph::world(size_t node) const {
+  return worlds_[index_of_[node]];
+}
+
+inline size_t SceneGraph::parent(size_t node) const {
+  size_t p = parents_[index_of_[node]];
+  return p == k_no_parent ? k_no_parent : id_of_[p];
+}
+
+inline size_t SceneGraph::node_count() const {
+  return id_of_.size();
+}
+
+inline size_t SceneGraph::level_count() const {
+  return level_begin_.size() - 1;
+}
+
+#endif
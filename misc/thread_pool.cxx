@@ -0,0 +1,97 @@
+#include "misc/thread_pool.h"
+
+void ThreadPool::init(size_t worker_count) {
+  stopping_ = false;
+  for (size_t i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::thread(&ThreadPool::worker_loop, this));
+  }
+}
+
+void ThreadPool::cleanup() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i].join();
+  }
+  workers_.clear();
+}
+
+void ThreadPool::run(ThreadPoolTask task, void* context, size_t count) {
+  if (workers_.empty() || count <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      task(context, i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = task;
+    context_ = context;
+    count_ = count;
+    next_index_ = 0;
+    active_ = workers_.size();
+    ++generation_;
+  }
+  wake_.notify_all();
+
+  run_indexes();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (active_ > 0) {
+    done_.wait(lock);
+  }
+}
+
+size_t ThreadPool::default_worker_count() {
+  unsigned hardware = std::thread::hardware_concurrency();
+  return hardware > 1 ? hardware - 1 : 0;
+}
+
+void ThreadPool::worker_loop() {
+  size_t seen = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!stopping_ && generation_ == seen) {
+        wake_.wait(lock);
+      }
+      if (stopping_) {
+        return;
+      }
+      seen = generation_;
+    }
+
+    run_indexes();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--active_ == 0) {
+      done_.notify_one();
+    }
+  }
+}
+
+void ThreadPool::run_indexes() {
+  while (true) {
+    size_t index = next_index_++;
+    if (index >= count_) {
+      return;
+    }
+    task_(context_, index);
+  }
+}
+
+void run_chunks(ThreadPool* pool, ThreadPoolTask task, void* context,
+                size_t item_count, size_t chunk_size) {
+  size_t chunk_count = (item_count + chunk_size - 1) / chunk_size;
+  if (pool && chunk_count > 1) {
+    pool->run(task, context, chunk_count);
+  } else {
+    for (size_t i = 0; i < chunk_count; ++i) {
+      task(context, i);
+    }
+  }
+}
@@ -0,0 +1,73 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef void (*ThreadPoolTask)(void* context, size_t index);
+
+// A fixed set of worker threads that run one task at a time over the
+// indexes [0, count). Indexes are handed out one by one, so uneven work
+// balances itself. The calling thread helps, so a pool without workers
+// simply runs everything inline.
+class ThreadPool {
+public:
+  ThreadPool();
+
+  // worker_count does not include the calling thread
+  void init(size_t worker_count);
+  void cleanup();
+
+  // workers plus the calling thread
+  size_t thread_count() const;
+
+  // Blocks until task has been called for every index.
+  void run(ThreadPoolTask task, void* context, size_t count);
+
+  // one worker per hardware thread besides the caller
+  static size_t default_worker_count();
+
+private:
+  void worker_loop();
+  void run_indexes();
+
+private:
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+
+  ThreadPoolTask task_;
+  void* context_;
+  size_t count_;
+  std::atomic<size_t> next_index_;
+  size_t active_;
+  size_t generation_;
+  bool stopping_;
+};
+
+// Calls task for each chunk of chunk_size items out of item_count, the
+// last one possibly shorter, on the pool, or inline when there is no pool
+// or only one chunk.
+void run_chunks(ThreadPool* pool, ThreadPoolTask task, void* context,
+                size_t item_count, size_t chunk_size);
+
+inline ThreadPool::ThreadPool()
+  : task_(NULL)
+  , context_(NULL)
+  , count_(0)
+  , next_index_(0)
+  , active_(0)
+  , generation_(0)
+  , stopping_(false)
+{}
+
+inline size_t ThreadPool::thread_count() const {
+  return workers_.size() + 1;
+}
+
+#endif
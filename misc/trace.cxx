@@ -0,0 +1,214 @@
+#ifdef GRAD_TRACE
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include "misc/trace.h"
+
+namespace {
+  enum EventType {
+    EVENT_ZONE,
+    EVENT_COUNTER,
+    EVENT_FRAME_MARK,
+  };
+
+  struct Event {
+    const char* name;
+    uint64_t begin_ns;
+    union {
+      uint64_t duration_ns;
+      double value;
+    };
+    EventType type;
+  };
+
+  // Events are appended to fixed-size chunks. Only the owning thread writes;
+  // it publishes each event by bumping count with release order, so the
+  // exporter can read any thread's events while they are being recorded.
+  struct Chunk {
+    enum {
+      CAPACITY = 4096,
+    };
+    Event events[CAPACITY];
+    std::atomic<size_t> count;
+    std::atomic<Chunk*> next;
+  };
+
+  const size_t k_max_chunks_per_thread = 256;
+
+  struct ThreadBuffer {
+    unsigned thread_index;
+    Chunk* first;
+    Chunk* last;
+    size_t chunk_count;
+    std::atomic<size_t> dropped;
+    ThreadBuffer* next;
+  };
+
+  std::atomic<ThreadBuffer*> g_buffers(NULL);
+  std::atomic<unsigned> g_thread_count(0);
+  const std::chrono::steady_clock::time_point g_epoch =
+    std::chrono::steady_clock::now();
+
+  Chunk* new_chunk() {
+    Chunk* chunk = new Chunk;
+    chunk->count.store(0, std::memory_order_relaxed);
+    chunk->next.store(NULL, std::memory_order_relaxed);
+    return chunk;
+  }
+
+  // Buffers are created on a thread's first event and live until exit, so
+  // the exporter never sees one disappear.
+  ThreadBuffer* thread_buffer() {
+    static thread_local ThreadBuffer* buffer = NULL;
+    if (buffer) {
+      return buffer;
+    }
+    buffer = new ThreadBuffer;
+    buffer->thread_index = g_thread_count.fetch_add(1);
+    buffer->first = new_chunk();
+    buffer->last = buffer->first;
+    buffer->chunk_count = 1;
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->next = g_buffers.load(std::memory_order_relaxed);
+    while (!g_buffers.compare_exchange_weak(buffer->next, buffer,
+        std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return buffer;
+  }
+
+  Event* next_event(ThreadBuffer* buffer) {
+    Chunk* chunk = buffer->last;
+    size_t count = chunk->count.load(std::memory_order_relaxed);
+    if (count == Chunk::CAPACITY) {
+      if (buffer->chunk_count == k_max_chunks_per_thread) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return NULL;
+      }
+      Chunk* next = new_chunk();
+      chunk->next.store(next, std::memory_order_release);
+      buffer->last = next;
+      ++buffer->chunk_count;
+      chunk = next;
+      count = 0;
+    }
+    return &chunk->events[count];
+  }
+
+  void publish(ThreadBuffer* buffer) {
+    Chunk* chunk = buffer->last;
+    chunk->count.store(chunk->count.load(std::memory_order_relaxed) + 1,
+      std::memory_order_release);
+  }
+
+  void write_event(FILE* file, unsigned tid, const Event& event, bool* first) {
+    fprintf(file, *first ? "\n" : ",\n");
+    *first = false;
+    double ts_us = event.begin_ns * 1e-3;
+    switch (event.type) {
+    case EVENT_ZONE:
+      fprintf(file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+        "\"ts\":%.3f,\"dur\":%.3f}",
+        event.name, tid, ts_us, event.duration_ns * 1e-3);
+      break;
+    case EVENT_COUNTER:
+      fprintf(file, "{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"tid\":%u,"
+        "\"ts\":%.3f,\"args\":{\"value\":%.9g}}",
+        event.name, tid, ts_us, event.value);
+      break;
+    case EVENT_FRAME_MARK:
+      fprintf(file, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,"
+        "\"tid\":%u,\"ts\":%.3f}",
+        event.name, tid, ts_us);
+      break;
+    }
+  }
+}
+
+namespace trace {
+  uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - g_epoch).count();
+  }
+
+  void record_zone(const char* name, uint64_t begin_ns, uint64_t end_ns) {
+    ThreadBuffer* buffer = thread_buffer();
+    Event* event = next_event(buffer);
+    if (!event) {
+      return;
+    }
+    event->name = name;
+    event->begin_ns = begin_ns;
+    event->duration_ns = end_ns - begin_ns;
+    event->type = EVENT_ZONE;
+    publish(buffer);
+  }
+
+  void record_counter(const char* name, double value) {
+    ThreadBuffer* buffer = thread_buffer();
+    Event* event = next_event(buffer);
+    if (!event) {
+      return;
+    }
+    event->name = name;
+    event->begin_ns = now_ns();
+    event->value = value;
+    event->type = EVENT_COUNTER;
+    publish(buffer);
+  }
+
+  void record_frame_mark() {
+    ThreadBuffer* buffer = thread_buffer();
+    Event* event = next_event(buffer);
+    if (!event) {
+      return;
+    }
+    event->name = "frame";
+    event->begin_ns = now_ns();
+    event->duration_ns = 0;
+    event->type = EVENT_FRAME_MARK;
+    publish(buffer);
+  }
+
+  bool write_chrome_json(const char* filename) {
+    FILE* file = fopen(filename, "w");
+    if (!file) {
+      fprintf(stderr, "Could not open %s for writing\n", filename);
+      return false;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    size_t dropped = 0;
+    for (ThreadBuffer* buffer = g_buffers.load(std::memory_order_acquire);
+         buffer; buffer = buffer->next) {
+      unsigned tid = buffer->thread_index;
+      fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+        "\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+        first ? "" : ",", tid, tid);
+      first = false;
+
+      for (Chunk* chunk = buffer->first; chunk;
+           chunk = chunk->next.load(std::memory_order_acquire)) {
+        size_t count = chunk->count.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+          write_event(file, tid, chunk->events[i], &first);
+        }
+      }
+      dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    fprintf(file, "\n]}\n");
+
+    if (fclose(file) != 0) {
+      fprintf(stderr, "Could not write %s\n", filename);
+      return false;
+    }
+    if (dropped) {
+      fprintf(stderr, "Trace buffers were full; %zu events dropped\n", dropped);
+    }
+    printf("Trace written to %s\n", filename);
+    return true;
+  }
+}
+
+#endif
@@ -0,0 +1,258 @@
+#include <algorithm>
+#include <cmath>
+#include <float.h>
+#include <string.h>
+#include "opengl/field_range.h"
+#include "opengl/gpu_memory.h"
+
+extern const char* const k_shaders_gradient_vert;
+extern const char* const k_shaders_fullscreen_vert;
+extern const char* const k_shaders_range_seed_frag;
+extern const char* const k_shaders_range_reduce_frag;
+extern const char* const k_shaders_range_histogram_vert;
+extern const char* const k_shaders_range_histogram_frag;
+
+namespace {
+  const size_t k_minmax_bytes = 2 * sizeof(float);
+}
+
+FieldRangeReducer::FieldRangeReducer()
+  : seed_mvp_id_(-1)
+  , histogram_bin_range_id_(-1)
+  , histogram_bin_count_id_(-1)
+  , empty_varray_id_(0)
+  , slots_()
+  , next_slot_(0)
+  , range_()
+  , have_range_(false)
+{
+  range_.max = 1;
+  range_.high = 1;
+}
+
+void FieldRangeReducer::init() {
+  seed_shader_.load_with_fallback(
+    "shaders/gradient.vert", k_shaders_gradient_vert,
+    "shaders/range_seed.frag", k_shaders_range_seed_frag);
+  seed_shader_.set_label("range seed");
+  seed_mvp_id_ = seed_shader_.uniform_location("v_mvp");
+
+  reduce_shader_.load_with_fallback(
+    "shaders/fullscreen.vert", k_shaders_fullscreen_vert,
+    "shaders/range_reduce.frag", k_shaders_range_reduce_frag);
+  reduce_shader_.set_label("range reduce");
+
+  histogram_shader_.load_with_fallback(
+    "shaders/range_histogram.vert", k_shaders_range_histogram_vert,
+    "shaders/range_histogram.frag", k_shaders_range_histogram_frag);
+  histogram_shader_.set_label("range histogram");
+  histogram_bin_range_id_ = histogram_shader_.uniform_location("f_bin_range");
+  histogram_bin_count_id_ = histogram_shader_.uniform_location("f_bin_count");
+
+  histogram_.init(GL_R32F);
+  histogram_.set_label("range histogram");
+  histogram_.resize(BIN_COUNT, 1);
+  glGenVertexArrays(1, &empty_varray_id_);
+
+  for (size_t i = 0; i < SLOT_COUNT; ++i) {
+    glGenBuffers(1, &slots_[i].buffer_id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slots_[i].buffer_id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, k_minmax_bytes + BIN_COUNT * sizeof(float),
+      NULL, GL_STREAM_READ);
+    gpu_memory_allocate(GPU_OBJECT_BUFFER, slots_[i].buffer_id, GPU_MEMORY_READBACK,
+      k_minmax_bytes + BIN_COUNT * sizeof(float), "range readback");
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FieldRangeReducer::resize(GLsizei width, GLsizei height) {
+  if (!levels_.empty() &&
+      levels_[0].width() == width && levels_[0].height() == height) {
+    return;
+  }
+  for (size_t i = 0; i < levels_.size(); ++i) {
+    levels_[i].cleanup();
+  }
+  levels_.clear();
+
+  while (true) {
+    levels_.push_back(RenderTarget());
+    levels_.back().init(GL_RG32F);
+    levels_.back().set_label("range level");
+    levels_.back().resize(width, height);
+    if (width == 1 && height == 1) {
+      break;
+    }
+    width = (width + 1) / 2;
+    height = (height + 1) / 2;
+  }
+}
+
+void FieldRangeReducer::cleanup() {
+  for (size_t i = 0; i < levels_.size(); ++i) {
+    levels_[i].cleanup();
+  }
+  levels_.clear();
+  histogram_.cleanup();
+  for (size_t i = 0; i < SLOT_COUNT; ++i) {
+    if (slots_[i].fence) {
+      glDeleteSync(slots_[i].fence);
+    }
+    gpu_memory_release(GPU_OBJECT_BUFFER, slots_[i].buffer_id);
+    glDeleteBuffers(1, &slots_[i].buffer_id);
+    slots_[i] = Slot();
+  }
+  glDeleteVertexArrays(1, &empty_varray_id_);
+  seed_shader_.destroy();
+  reduce_shader_.destroy();
+  histogram_shader_.destroy();
+}
+
+void FieldRangeReducer::reduce(GLuint field_texture, const mat4f& mvp,
+    GLuint quad_varray_id) {
+  if (slots_[next_slot_].fence) {
+    // every slot is still in flight; skip this frame rather than wait
+    return;
+  }
+
+  seed(field_texture, mvp, quad_varray_id);
+  reduce_levels();
+  build_histogram();
+  read_back();
+
+  // level 0 has the size given to resize(), so this restores the caller's
+  // viewport without asking GL for it
+  RenderTarget::unbind();
+  glViewport(0, 0, levels_[0].width(), levels_[0].height());
+  glActiveTexture(GL_TEXTURE0 + 0);
+}
+
+void FieldRangeReducer::seed(GLuint field_texture, const mat4f& mvp,
+    GLuint quad_varray_id) {
+  levels_[0].bind();
+  glClearColor(FLT_MAX, -FLT_MAX, 0, 0);
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  seed_shader_.use();
+  seed_shader_.set_uniform(seed_mvp_id_, mvp);
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glBindTexture(GL_TEXTURE_2D, field_texture);
+  glBindVertexArray(quad_varray_id);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+void FieldRangeReducer::reduce_levels() {
+  reduce_shader_.use();
+  glBindVertexArray(empty_varray_id_);
+  glActiveTexture(GL_TEXTURE0 + 0);
+  for (size_t i = 1; i < levels_.size(); ++i) {
+    levels_[i].bind();
+    glBindTexture(GL_TEXTURE_2D, levels_[i - 1].texture());
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+}
+
+void FieldRangeReducer::build_histogram() {
+  Slot& slot = slots_[next_slot_];
+  slot.bin_min = range_.min;
+  slot.bin_max = range_.max;
+
+  histogram_.bind();
+  glClearColor(0, 0, 0, 0);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glEnable(GL_BLEND);
+  glBlendEquation(GL_FUNC_ADD);
+  glBlendFunc(GL_ONE, GL_ONE);
+
+  histogram_shader_.use();
+  glUniform2f(histogram_bin_range_id_, slot.bin_min, slot.bin_max);
+  glUniform1i(histogram_bin_count_id_, BIN_COUNT);
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glBindTexture(GL_TEXTURE_2D, levels_[0].texture());
+  glBindVertexArray(empty_varray_id_);
+  glDrawArrays(GL_POINTS, 0, levels_[0].width() * levels_[0].height());
+
+  glDisable(GL_BLEND);
+}
+
+void FieldRangeReducer::read_back() {
+  Slot& slot = slots_[next_slot_];
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer_id);
+  levels_.back().bind();
+  glReadPixels(0, 0, 1, 1, GL_RG, GL_FLOAT, (void*)0);
+  histogram_.bind();
+  glReadPixels(0, 0, BIN_COUNT, 1, GL_RED, GL_FLOAT, (void*)k_minmax_bytes);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  next_slot_ = (next_slot_ + 1) % SLOT_COUNT;
+}
+
+bool FieldRangeReducer::poll() {
+  bool updated = false;
+  // slots complete in submission order, and next_slot_ is the oldest
+  for (size_t n = 0; n < SLOT_COUNT; ++n) {
+    Slot& slot = slots_[(next_slot_ + n) % SLOT_COUNT];
+    if (!slot.fence) {
+      continue;
+    }
+    GLenum status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+      break;
+    }
+    glDeleteSync(slot.fence);
+    slot.fence = 0;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer_id);
+    const float* data = (const float*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+      k_minmax_bytes + BIN_COUNT * sizeof(float), GL_MAP_READ_BIT);
+    if (data) {
+      FieldRange previous = range_;
+      update_range(data, data + 2, slot.bin_min, slot.bin_max);
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+      float tolerance = (range_.max - range_.min) / BIN_COUNT;
+      updated = updated || !have_range_ ||
+        std::fabs(range_.low - previous.low) > tolerance ||
+        std::fabs(range_.high - previous.high) > tolerance ||
+        range_.min != previous.min || range_.max != previous.max;
+      have_range_ = true;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+  return updated;
+}
+
+void FieldRangeReducer::update_range(const float* minmax, const float* bins,
+    float bin_min, float bin_max) {
+  if (minmax[0] > minmax[1]) {
+    return; // the quad is off screen
+  }
+  range_.min = minmax[0];
+  range_.max = minmax[1];
+
+  float total = 0;
+  for (size_t i = 0; i < BIN_COUNT; ++i) {
+    total += bins[i];
+  }
+  if (total == 0) {
+    return;
+  }
+
+  const float targets[3] = {
+    k_range_low_percentile, 0.5f, k_range_high_percentile };
+  float* results[3] = { &range_.low, &range_.median, &range_.high };
+  float bin_width = (bin_max - bin_min) / BIN_COUNT;
+  float count = 0;
+  size_t bin = 0;
+  for (size_t t = 0; t < 3; ++t) {
+    float target = targets[t] * total;
+    while (bin + 1 < BIN_COUNT && count + bins[bin] < target) {
+      count += bins[bin];
+      ++bin;
+    }
+    float fraction = bins[bin] > 0 ? (target - count) / bins[bin] : 0;
+    float value = bin_min + (bin + std::min(fraction, 1.f)) * bin_width;
+    // the bins may be from an older range than min and max
+    *results[t] = std::min(std::max(value, range_.min), range_.max);
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef FIELD_RANGE_H
+#define FIELD_RANGE_H
+
+#include <vector>
+#include <glad/glad.h>
+#include "math/mat4f.h"
+#include "opengl/render_target.h"
+#include "opengl/shader_program.h"
+
+struct FieldRange {
+  float min;
+  float max;
+  float low;     // k_range_low_percentile
+  float median;
+  float high;    // k_range_high_percentile
+};
+
+const float k_range_low_percentile = 0.01f;
+const float k_range_high_percentile = 0.99f;
+
+// Finds the range of a scalar field under the quad on the GPU.
+//
+// The field is copied into (min, max) pairs and halved until a single texel
+// remains. A histogram over the last known range gives the percentiles.
+// Results are read back through a ring of pixel buffers guarded by fences,
+// so nothing ever waits on the GPU; they arrive through poll() a frame or
+// more after reduce() is called.
+class FieldRangeReducer {
+public:
+  FieldRangeReducer();
+
+  void init();
+  void resize(GLsizei width, GLsizei height);
+  void cleanup();
+
+  // Leaves the default framebuffer bound, with a viewport of the size last
+  // given to resize().
+  void reduce(GLuint field_texture, const mat4f& mvp, GLuint quad_varray_id);
+  // returns true if a new range arrived since the last call
+  bool poll();
+
+  const FieldRange& range() const;
+
+private:
+  enum {
+    SLOT_COUNT = 3,
+    BIN_COUNT = 256,
+  };
+
+  struct Slot {
+    GLuint buffer_id;
+    GLsync fence;
+    float bin_min;
+    float bin_max;
+  };
+
+  void seed(GLuint field_texture, const mat4f& mvp, GLuint quad_varray_id);
+  void reduce_levels();
+  void build_histogram();
+  void read_back();
+  void update_range(const float* minmax, const float* bins,
+                    float bin_min, float bin_max);
+
+private:
+  ShaderProgram seed_shader_;
+  ShaderProgram reduce_shader_;
+  ShaderProgram histogram_shader_;
+  GLint seed_mvp_id_;
+  GLint histogram_bin_range_id_;
+  GLint histogram_bin_count_id_;
+
+  std::vector<RenderTarget> levels_;
+  RenderTarget histogram_;
+  GLuint empty_varray_id_;
+
+  Slot slots_[SLOT_COUNT];
+  size_t next_slot_;
+
+  FieldRange range_;
+  bool have_range_;
+};
+
+inline const FieldRange& FieldRangeReducer::range() const {
+  return range_;
+}
+
+#endif
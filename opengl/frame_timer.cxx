@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include "opengl/frame_timer.h"
+
+void FrameTimer::init(const char* const* cpu_names, size_t cpu_count,
+                      const char* const* gpu_names, size_t gpu_count) {
+  cpu_count_ = cpu_count;
+  gpu_count_ = gpu_count;
+  names_.assign(cpu_names, cpu_names + cpu_count);
+  names_.insert(names_.end(), gpu_names, gpu_names + gpu_count);
+
+  cpu_begin_.resize(cpu_count);
+  query_ids_.resize(QUERY_FRAMES * gpu_count);
+  query_frames_.assign(QUERY_FRAMES * gpu_count, 0);
+  query_pending_.assign(QUERY_FRAMES * gpu_count, false);
+  dropped_.assign(gpu_count, 0);
+  if (gpu_count > 0) {
+    glGenQueries(QUERY_FRAMES * gpu_count, query_ids_.data());
+  }
+
+  samples_.assign((whole_run_ ? 1 : HISTORY) * column_count(), NAN);
+  frame_ = 0;
+}
+
+void FrameTimer::cleanup() {
+  if (!query_ids_.empty()) {
+    glDeleteQueries(query_ids_.size(), query_ids_.data());
+  }
+  query_ids_.clear();
+  query_frames_.clear();
+  query_pending_.clear();
+  dropped_.clear();
+  samples_.clear();
+  frame_ = 0;
+}
+
+void FrameTimer::begin_cpu(size_t section) {
+  cpu_begin_[section] = Clock::now();
+}
+
+void FrameTimer::end_cpu(size_t section) {
+  std::chrono::duration<float, std::milli> elapsed =
+    Clock::now() - cpu_begin_[section];
+  float& sample = row(frame_)[section];
+  // a section that runs more than once in a frame is summed
+  sample = std::isnan(sample) ? elapsed.count() : sample + elapsed.count();
+}
+
+size_t FrameTimer::query_index(size_t pass, size_t frame) const {
+  return QUERY_FRAMES * pass + frame % QUERY_FRAMES;
+}
+
+void FrameTimer::begin_gpu(size_t pass) {
+  size_t query = query_index(pass, frame_);
+  if (query_pending_[query] && query_frames_[query] != frame_) {
+    // still waiting on the result from QUERY_FRAMES frames ago, which
+    // is more likely a slow frame than this one will be
+    ++dropped_[pass];
+    return;
+  }
+  glBeginQuery(GL_TIME_ELAPSED, query_ids_[query]);
+  query_frames_[query] = frame_;
+  query_pending_[query] = true;
+}
+
+void FrameTimer::end_gpu(size_t pass) {
+  size_t query = query_index(pass, frame_);
+  if (query_pending_[query] && query_frames_[query] == frame_) {
+    glEndQuery(GL_TIME_ELAPSED);
+  }
+}
+
+void FrameTimer::end_frame() {
+  collect_gpu();
+  ++frame_;
+  if (whole_run_) {
+    samples_.resize(samples_.size() + column_count(), NAN);
+  } else {
+    float* next = row(frame_);
+    std::fill(next, next + column_count(), NAN);
+  }
+}
+
+void FrameTimer::discard_frame() {
+  float* current = row(frame_);
+  std::fill(current, current + cpu_count_, NAN);
+}
+
+// Reads every result that has arrived from an earlier frame into the row of
+// the frame that issued it.
+void FrameTimer::collect_gpu() {
+  for (size_t pass = 0; pass < gpu_count_; ++pass) {
+    for (size_t slot = 0; slot < QUERY_FRAMES; ++slot) {
+      size_t query = QUERY_FRAMES * pass + slot;
+      if (!query_pending_[query] || query_frames_[query] == frame_) {
+        continue;
+      }
+      GLuint available = 0;
+      glGetQueryObjectuiv(query_ids_[query], GL_QUERY_RESULT_AVAILABLE, &available);
+      if (!available) {
+        continue;
+      }
+      GLuint64 nanoseconds = 0;
+      glGetQueryObjectui64v(query_ids_[query], GL_QUERY_RESULT, &nanoseconds);
+      query_pending_[query] = false;
+      if (frame_ - query_frames_[query] >= row_count()) {
+        // its row has been reused since
+        ++dropped_[pass];
+        continue;
+      }
+      row(query_frames_[query])[cpu_count_ + pass] = nanoseconds * 1e-6f;
+    }
+  }
+}
+
+void FrameTimer::recent_cpu(size_t section, size_t count, float* out) const {
+  recent(section, count, out);
+}
+
+void FrameTimer::recent_gpu(size_t pass, size_t count, float* out) const {
+  recent(cpu_count_ + pass, count, out);
+}
+
+void FrameTimer::recent(size_t column, size_t count, float* out) const {
+  // the current frame is still being recorded, so end at the one before
+  for (size_t i = 0; i < count; ++i) {
+    size_t back = count - i;
+    if (back > frame_ || back >= row_count()) {
+      out[i] = NAN;
+    } else {
+      out[i] = row(frame_ - back)[column];
+    }
+  }
+}
+
+size_t FrameTimer::column_count() const {
+  return cpu_count_ + gpu_count_;
+}
+
+size_t FrameTimer::row_count() const {
+  return whole_run_ ? frame_ + 1 : (size_t)HISTORY;
+}
+
+float* FrameTimer::row(size_t frame) {
+  return samples_.data() + (frame % row_count()) * column_count();
+}
+
+const float* FrameTimer::row(size_t frame) const {
+  return samples_.data() + (frame % row_count()) * column_count();
+}
+
+FrameTimer::Stats FrameTimer::stats(size_t column) const {
+  std::vector<float> values;
+  values.reserve(row_count());
+  for (size_t i = 0; i < row_count(); ++i) {
+    float value = samples_[i * column_count() + column];
+    if (!std::isnan(value)) {
+      values.push_back(value);
+    }
+  }
+
+  Stats result;
+  memset(&result, 0, sizeof(result));
+  result.count = values.size();
+  result.dropped = column < cpu_count_ ? 0 : dropped_[column - cpu_count_];
+  if (values.empty()) {
+    return result;
+  }
+
+  std::sort(values.begin(), values.end());
+  double sum = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    sum += values[i];
+  }
+  // nearest rank
+  const size_t n = values.size();
+  result.mean = (float)(sum / n);
+  result.p50 = values[(n * 50 + 99) / 100 - 1];
+  result.p95 = values[(n * 95 + 99) / 100 - 1];
+  result.p99 = values[(n * 99 + 99) / 100 - 1];
+  result.max = values.back();
+  return result;
+}
+
+void FrameTimer::print_summary() const {
+  printf("%-16s %-4s %6s %7s %9s %9s %9s %9s %9s\n",
+    "section", "", "count", "dropped", "mean ms", "p50", "p95", "p99", "max");
+  for (size_t i = 0; i < column_count(); ++i) {
+    Stats s = stats(i);
+    printf("%-16s %-4s %6zu %7zu %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+      names_[i], i < cpu_count_ ? "cpu" : "gpu",
+      s.count, s.dropped, s.mean, s.p50, s.p95, s.p99, s.max);
+  }
+}
+
+bool FrameTimer::write(const char* filename) const {
+  FILE* file = fopen(filename, "w");
+  if (!file) {
+    fprintf(stderr, "Could not open %s for writing\n", filename);
+    return false;
+  }
+
+  size_t length = strlen(filename);
+  bool json = length >= 5 && strcmp(filename + length - 5, ".json") == 0;
+  if (json) {
+    fprintf(file, "{\n  \"frames\": %zu,\n  \"sections\": [\n", frame_);
+  } else {
+    fprintf(file, "section,clock,count,dropped,mean_ms,p50_ms,p95_ms,p99_ms,max_ms\n");
+  }
+  for (size_t i = 0; i < column_count(); ++i) {
+    Stats s = stats(i);
+    const char* clock = i < cpu_count_ ? "cpu" : "gpu";
+    if (json) {
+      fprintf(file,
+        "    {\"name\": \"%s\", \"clock\": \"%s\", \"count\": %zu, \"dropped\": %zu, "
+        "\"mean_ms\": %.6f, \"p50_ms\": %.6f, \"p95_ms\": %.6f, "
+        "\"p99_ms\": %.6f, \"max_ms\": %.6f}%s\n",
+        names_[i], clock, s.count, s.dropped, s.mean, s.p50, s.p95, s.p99, s.max,
+        i + 1 < column_count() ? "," : "");
+    } else {
+      fprintf(file, "%s,%s,%zu,%zu,%.6f,%.6f,%.6f,%.6f,%.6f\n",
+        names_[i], clock, s.count, s.dropped, s.mean, s.p50, s.p95, s.p99, s.max);
+    }
+  }
+  if (json) {
+    fprintf(file, "  ]\n}\n");
+  }
+
+  if (fclose(file) != 0) {
+    fprintf(stderr, "Could not write %s\n", filename);
+    return false;
+  }
+  printf("Frame times written to %s\n", filename);
+  return true;
+}
@@ -0,0 +1,112 @@
+#ifndef FRAME_TIMER_H
+#define FRAME_TIMER_H
+
+#include <stddef.h>
+#include <chrono>
+#include <vector>
+#include <glad/glad.h>
+
+// Per-frame timings of named CPU sections and GPU passes, kept for the last
+// HISTORY frames with p50/p95/p99 over that window, or for every frame of
+// the run when keep_whole_run is called first.
+//
+// GPU passes are timed with GL_TIME_ELAPSED queries, a ring of QUERY_FRAMES
+// per pass. Results are read once they are available, however many frames
+// that takes, and go to the frame that issued them, so reading never waits
+// on the GPU and slow frames are not lost. Only when a pass comes round to
+// a query that is still waiting is that frame's pass left untimed; those
+// samples are counted as dropped. Elapsed-time queries cannot nest, so GPU
+// passes must not overlap.
+class FrameTimer {
+public:
+  FrameTimer();
+
+  // The names must outlive the timer.
+  void init(const char* const* cpu_names, size_t cpu_count,
+            const char* const* gpu_names, size_t gpu_count);
+  // Keeps every frame rather than the last HISTORY, so the statistics of a
+  // replay or script cover all of it. Must be called before init. Costs 4
+  // bytes per section per frame, about 10 MB for an hour at 60 frames/s.
+  void keep_whole_run();
+  void cleanup();
+
+  void begin_cpu(size_t section);
+  void end_cpu(size_t section);
+  void begin_gpu(size_t pass);
+  void end_gpu(size_t pass);
+
+  // Collects the previous frame's GPU results and starts a new frame.
+  void end_frame();
+  // Forgets the CPU sections timed since the last end_frame, for a pass of
+  // the main loop that displayed nothing and so is not a frame.
+  void discard_frame();
+
+  // The last count samples of a section or pass, oldest first, NaN where
+  // it did not run. GPU passes trail the CPU sections by a frame or more.
+  void recent_cpu(size_t section, size_t count, float* out) const;
+  void recent_gpu(size_t pass, size_t count, float* out) const;
+
+  void print_summary() const;
+  // JSON if the name ends in .json, CSV otherwise
+  bool write(const char* filename) const;
+
+private:
+  enum {
+    HISTORY = 512,
+    QUERY_FRAMES = 4,
+  };
+
+  struct Stats {
+    size_t count;
+    size_t dropped;
+    float mean;
+    float p50;
+    float p95;
+    float p99;
+    float max;
+  };
+
+  typedef std::chrono::steady_clock Clock;
+
+  size_t column_count() const;
+  size_t row_count() const;
+  float* row(size_t frame);
+  const float* row(size_t frame) const;
+  void recent(size_t column, size_t count, float* out) const;
+  Stats stats(size_t column) const;
+  size_t query_index(size_t pass, size_t frame) const;
+  void collect_gpu();
+
+private:
+  std::vector<const char*> names_;
+  size_t cpu_count_;
+  size_t gpu_count_;
+
+  std::vector<Clock::time_point> cpu_begin_;
+  // QUERY_FRAMES per pass, the frame each was last issued in, and whether
+  // its result is still to be read
+  std::vector<GLuint> query_ids_;
+  std::vector<size_t> query_frames_;
+  std::vector<bool> query_pending_;
+  // per pass, the frames left untimed because their query was still busy
+  std::vector<size_t> dropped_;
+
+  // HISTORY rows, or one per frame so far if whole_run_, of one sample per
+  // column in milliseconds, NaN if the section did not run that frame
+  std::vector<float> samples_;
+  size_t frame_;
+  bool whole_run_;
+};
+
+inline FrameTimer::FrameTimer()
+  : cpu_count_(0)
+  , gpu_count_(0)
+  , frame_(0)
+  , whole_run_(false)
+{}
+
+inline void FrameTimer::keep_whole_run() {
+  whole_run_ = true;
+}
+
+#endif
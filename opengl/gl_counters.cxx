@@ -0,0 +1,262 @@
+#include <string.h>
+#include <glad/glad.h>
+#include "opengl/gl_counters.h"
+#include "opengl/opengl_common.h"
+
+namespace {
+  const GLenum k_gpu_memory_total_nvx = 0x9048;
+  const GLenum k_gpu_memory_available_nvx = 0x9049;
+  const GLenum k_texture_free_memory_ati = 0x87FC;
+
+  GlCounts g_counts;
+  bool g_have_nvx_memory = false;
+  bool g_have_ati_memory = false;
+
+  PFNGLDRAWARRAYSPROC g_draw_arrays;
+  PFNGLDRAWARRAYSINSTANCEDPROC g_draw_arrays_instanced;
+  PFNGLDRAWELEMENTSPROC g_draw_elements;
+  PFNGLDRAWELEMENTSINSTANCEDPROC g_draw_elements_instanced;
+  PFNGLUSEPROGRAMPROC g_use_program;
+  PFNGLBINDVERTEXARRAYPROC g_bind_vertex_array;
+  PFNGLBINDTEXTUREPROC g_bind_texture;
+  PFNGLACTIVETEXTUREPROC g_active_texture;
+  PFNGLBINDBUFFERPROC g_bind_buffer;
+  PFNGLBINDFRAMEBUFFERPROC g_bind_framebuffer;
+  PFNGLENABLEPROC g_enable;
+  PFNGLDISABLEPROC g_disable;
+  PFNGLBLENDFUNCPROC g_blend_func;
+  PFNGLBLENDEQUATIONPROC g_blend_equation;
+  PFNGLVIEWPORTPROC g_viewport;
+  PFNGLBUFFERDATAPROC g_buffer_data;
+  PFNGLBUFFERSUBDATAPROC g_buffer_sub_data;
+  PFNGLTEXIMAGE1DPROC g_tex_image_1d;
+  PFNGLTEXIMAGE2DPROC g_tex_image_2d;
+  PFNGLTEXIMAGE3DPROC g_tex_image_3d;
+  PFNGLTEXSUBIMAGE1DPROC g_tex_sub_image_1d;
+  PFNGLTEXSUBIMAGE2DPROC g_tex_sub_image_2d;
+  PFNGLTEXSUBIMAGE3DPROC g_tex_sub_image_3d;
+
+  size_t pixel_bytes(GLenum format, GLenum type) {
+    size_t components = 4;
+    switch (format) {
+      case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: components = 1; break;
+      case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL: components = 2; break;
+      case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: components = 3; break;
+    }
+    switch (type) {
+      case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+      case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return 2 * components;
+      case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: return 4 * components;
+      default: return 4;  // packed formats
+    }
+  }
+
+  void count_texels(const void* pixels, GLenum format, GLenum type, size_t texels) {
+    if (pixels) {
+      g_counts.upload_bytes += texels * pixel_bytes(format, type);
+    }
+  }
+
+  void APIENTRY draw_arrays(GLenum mode, GLint first, GLsizei count) {
+    ++g_counts.draw_calls;
+    g_draw_arrays(mode, first, count);
+  }
+
+  void APIENTRY draw_arrays_instanced(GLenum mode, GLint first, GLsizei count,
+      GLsizei instances) {
+    ++g_counts.draw_calls;
+    g_draw_arrays_instanced(mode, first, count, instances);
+  }
+
+  void APIENTRY draw_elements(GLenum mode, GLsizei count, GLenum type,
+      const void* indices) {
+    ++g_counts.draw_calls;
+    g_draw_elements(mode, count, type, indices);
+  }
+
+  void APIENTRY draw_elements_instanced(GLenum mode, GLsizei count, GLenum type,
+      const void* indices, GLsizei instances) {
+    ++g_counts.draw_calls;
+    g_draw_elements_instanced(mode, count, type, indices, instances);
+  }
+
+  void APIENTRY use_program(GLuint program) {
+    ++g_counts.state_changes;
+    g_use_program(program);
+  }
+
+  void APIENTRY bind_vertex_array(GLuint array) {
+    ++g_counts.state_changes;
+    g_bind_vertex_array(array);
+  }
+
+  void APIENTRY bind_texture(GLenum target, GLuint texture) {
+    ++g_counts.state_changes;
+    g_bind_texture(target, texture);
+  }
+
+  void APIENTRY active_texture(GLenum texture) {
+    ++g_counts.state_changes;
+    g_active_texture(texture);
+  }
+
+  void APIENTRY bind_buffer(GLenum target, GLuint buffer) {
+    ++g_counts.state_changes;
+    g_bind_buffer(target, buffer);
+  }
+
+  void APIENTRY bind_framebuffer(GLenum target, GLuint framebuffer) {
+    ++g_counts.state_changes;
+    g_bind_framebuffer(target, framebuffer);
+  }
+
+  void APIENTRY enable(GLenum cap) {
+    ++g_counts.state_changes;
+    g_enable(cap);
+  }
+
+  void APIENTRY disable(GLenum cap) {
+    ++g_counts.state_changes;
+    g_disable(cap);
+  }
+
+  void APIENTRY blend_func(GLenum source, GLenum destination) {
+    ++g_counts.state_changes;
+    g_blend_func(source, destination);
+  }
+
+  void APIENTRY blend_equation(GLenum mode) {
+    ++g_counts.state_changes;
+    g_blend_equation(mode);
+  }
+
+  void APIENTRY viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    ++g_counts.state_changes;
+    g_viewport(x, y, width, height);
+  }
+
+  void APIENTRY buffer_data(GLenum target, GLsizeiptr size, const void* data,
+      GLenum usage) {
+    if (data) {
+      g_counts.upload_bytes += size;
+    }
+    g_buffer_data(target, size, data, usage);
+  }
+
+  void APIENTRY buffer_sub_data(GLenum target, GLintptr offset, GLsizeiptr size,
+      const void* data) {
+    g_counts.upload_bytes += size;
+    g_buffer_sub_data(target, offset, size, data);
+  }
+
+  void APIENTRY tex_image_1d(GLenum target, GLint level, GLint internal_format,
+      GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels) {
+    count_texels(pixels, format, type, width);
+    g_tex_image_1d(target, level, internal_format, width, border, format, type, pixels);
+  }
+
+  void APIENTRY tex_image_2d(GLenum target, GLint level, GLint internal_format,
+      GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type,
+      const void* pixels) {
+    count_texels(pixels, format, type, (size_t)width * height);
+    g_tex_image_2d(target, level, internal_format, width, height, border,
+      format, type, pixels);
+  }
+
+  void APIENTRY tex_image_3d(GLenum target, GLint level, GLint internal_format,
+      GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format,
+      GLenum type, const void* pixels) {
+    count_texels(pixels, format, type, (size_t)width * height * depth);
+    g_tex_image_3d(target, level, internal_format, width, height, depth, border,
+      format, type, pixels);
+  }
+
+  void APIENTRY tex_sub_image_1d(GLenum target, GLint level, GLint x,
+      GLsizei width, GLenum format, GLenum type, const void* pixels) {
+    count_texels(pixels, format, type, width);
+    g_tex_sub_image_1d(target, level, x, width, format, type, pixels);
+  }
+
+  void APIENTRY tex_sub_image_2d(GLenum target, GLint level, GLint x, GLint y,
+      GLsizei width, GLsizei height, GLenum format, GLenum type,
+      const void* pixels) {
+    count_texels(pixels, format, type, (size_t)width * height);
+    g_tex_sub_image_2d(target, level, x, y, width, height, format, type, pixels);
+  }
+
+  void APIENTRY tex_sub_image_3d(GLenum target, GLint level, GLint x, GLint y,
+      GLint z, GLsizei width, GLsizei height, GLsizei depth, GLenum format,
+      GLenum type, const void* pixels) {
+    count_texels(pixels, format, type, (size_t)width * height * depth);
+    g_tex_sub_image_3d(target, level, x, y, z, width, height, depth,
+      format, type, pixels);
+  }
+
+  // Keeps the loaded entry point and puts the counting one in its place.
+  template <typename Proc>
+  void wrap(Proc* entry_point, Proc* original, Proc replacement) {
+    if (*entry_point && *entry_point != replacement) {
+      *original = *entry_point;
+      *entry_point = replacement;
+    }
+  }
+}
+
+void gl_counters_install() {
+  wrap(&glad_glDrawArrays, &g_draw_arrays, draw_arrays);
+  wrap(&glad_glDrawArraysInstanced, &g_draw_arrays_instanced, draw_arrays_instanced);
+  wrap(&glad_glDrawElements, &g_draw_elements, draw_elements);
+  wrap(&glad_glDrawElementsInstanced, &g_draw_elements_instanced, draw_elements_instanced);
+  wrap(&glad_glUseProgram, &g_use_program, use_program);
+  wrap(&glad_glBindVertexArray, &g_bind_vertex_array, bind_vertex_array);
+  wrap(&glad_glBindTexture, &g_bind_texture, bind_texture);
+  wrap(&glad_glActiveTexture, &g_active_texture, active_texture);
+  wrap(&glad_glBindBuffer, &g_bind_buffer, bind_buffer);
+  wrap(&glad_glBindFramebuffer, &g_bind_framebuffer, bind_framebuffer);
+  wrap(&glad_glEnable, &g_enable, enable);
+  wrap(&glad_glDisable, &g_disable, disable);
+  wrap(&glad_glBlendFunc, &g_blend_func, blend_func);
+  wrap(&glad_glBlendEquation, &g_blend_equation, blend_equation);
+  wrap(&glad_glViewport, &g_viewport, viewport);
+  wrap(&glad_glBufferData, &g_buffer_data, buffer_data);
+  wrap(&glad_glBufferSubData, &g_buffer_sub_data, buffer_sub_data);
+  wrap(&glad_glTexImage1D, &g_tex_image_1d, tex_image_1d);
+  wrap(&glad_glTexImage2D, &g_tex_image_2d, tex_image_2d);
+  wrap(&glad_glTexImage3D, &g_tex_image_3d, tex_image_3d);
+  wrap(&glad_glTexSubImage1D, &g_tex_sub_image_1d, tex_sub_image_1d);
+  wrap(&glad_glTexSubImage2D, &g_tex_sub_image_2d, tex_sub_image_2d);
+  wrap(&glad_glTexSubImage3D, &g_tex_sub_image_3d, tex_sub_image_3d);
+
+  g_have_nvx_memory = have_gl_extension("GL_NVX_gpu_memory_info");
+  g_have_ati_memory = have_gl_extension("GL_ATI_meminfo");
+  memset(&g_counts, 0, sizeof(g_counts));
+}
+
+GlCounts gl_counters_end_frame() {
+  GlCounts counts = g_counts;
+  memset(&g_counts, 0, sizeof(g_counts));
+  return counts;
+}
+
+GlMemory gl_counters_memory() {
+  GlMemory memory;
+  memset(&memory, 0, sizeof(memory));
+  if (g_have_nvx_memory) {
+    GLint total = 0;
+    GLint available = 0;
+    glGetIntegerv(k_gpu_memory_total_nvx, &total);
+    glGetIntegerv(k_gpu_memory_available_nvx, &available);
+    memory.have_used = true;
+    memory.have_free = true;
+    memory.total_kb = total;
+    memory.free_kb = available;
+    memory.used_kb = total - available;
+  } else if (g_have_ati_memory) {
+    // the first of four values is the total free memory in the texture pool
+    GLint free[4] = {0, 0, 0, 0};
+    glGetIntegerv(k_texture_free_memory_ati, free);
+    memory.have_free = true;
+    memory.free_kb = free[0];
+  }
+  return memory;
+}
@@ -0,0 +1,35 @@
+#ifndef GL_COUNTERS_H
+#define GL_COUNTERS_H
+
+#include <stddef.h>
+
+// Per-frame counts of the GL work submitted by the application.
+//
+// gl_counters_install replaces the draw, state and upload entry points that
+// glad loaded with versions that count their calls before forwarding them,
+// so every caller is counted without changes. It must run after glad has
+// loaded and before anything is drawn.
+struct GlCounts {
+  size_t draw_calls;
+  size_t state_changes;  // program, vertex array, texture, buffer, framebuffer,
+                         // enable, blend and viewport changes
+  size_t upload_bytes;   // client memory passed to glBufferData, glTexImage
+                         // and their Sub variants
+};
+
+// Resident video memory, from GL_NVX_gpu_memory_info or GL_ATI_meminfo.
+// Drivers with neither report nothing.
+struct GlMemory {
+  bool have_used;
+  bool have_free;
+  size_t used_kb;
+  size_t free_kb;
+  size_t total_kb;
+};
+
+void gl_counters_install();
+// The counts since the previous call, which starts a new frame.
+GlCounts gl_counters_end_frame();
+GlMemory gl_counters_memory();
+
+#endif
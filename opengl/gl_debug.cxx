@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "misc/trace.h"
+#include "opengl/gl_debug.h"
+#include "opengl/opengl_common.h"
+
+namespace {
+  // KHR_debug, from glcorearb.h
+  const GLenum k_debug_output = 0x92E0;
+  const GLenum k_debug_type_error = 0x824C;
+  const GLenum k_debug_type_performance = 0x8250;
+  const GLenum k_debug_severity_notification = 0x826B;
+  const GLint k_context_flag_debug_bit = 0x2;
+  const GLenum k_buffer = 0x82E0;
+  const GLenum k_program = 0x82E2;
+  const GLenum k_vertex_array = 0x8074;
+
+  typedef void (APIENTRY *DebugProc)(GLenum source, GLenum type, GLuint id,
+    GLenum severity, GLsizei length, const GLchar* message, const void* user);
+  typedef void (APIENTRYP DebugMessageCallbackProc)(DebugProc callback,
+    const void* user);
+  typedef void (APIENTRYP ObjectLabelProc)(GLenum identifier, GLuint name,
+    GLsizei length, const GLchar* label);
+
+  ObjectLabelProc g_object_label = NULL;
+
+  struct Message {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    size_t count;
+    std::string text;
+  };
+
+  typedef std::chrono::steady_clock Clock;
+
+  // the callback may run on a driver thread
+  std::mutex g_mutex;
+  std::vector<Message> g_messages;
+  GlDebugCounts g_counts;
+  Clock::time_point g_window_begin;
+  size_t g_window_lines = 0;
+  size_t g_suppressed = 0;
+
+  const char* type_name(GLenum type) {
+    switch (type) {
+      case k_debug_type_error: return "error";
+      case k_debug_type_performance: return "performance";
+      case 0x824D: return "deprecated";
+      case 0x824E: return "undefined behaviour";
+      case 0x824F: return "portability";
+      case 0x8251: return "other";
+      case 0x8268: return "marker";
+      default: return "message";
+    }
+  }
+
+  // true if another line may be logged in the current second
+  bool take_log_line() {
+    Clock::time_point now = Clock::now();
+    if (now - g_window_begin >= std::chrono::seconds(1)) {
+      if (g_suppressed > 0) {
+        fprintf(stderr, "GL debug: %zu messages not shown\n", g_suppressed);
+      }
+      g_window_begin = now;
+      g_window_lines = 0;
+      g_suppressed = 0;
+    }
+    if (g_window_lines >= k_gl_debug_log_rate) {
+      ++g_suppressed;
+      return false;
+    }
+    ++g_window_lines;
+    return true;
+  }
+
+  void APIENTRY on_message(GLenum source, GLenum type, GLuint id,
+      GLenum severity, GLsizei length, const GLchar* text, const void* user) {
+    (void)user;
+    if (severity == k_debug_severity_notification) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (type == k_debug_type_performance) {
+      ++g_counts.performance;
+    } else if (type == k_debug_type_error) {
+      ++g_counts.errors;
+    } else {
+      ++g_counts.other;
+    }
+
+    for (size_t i = 0; i < g_messages.size(); ++i) {
+      Message& message = g_messages[i];
+      if (message.source == source && message.type == type && message.id == id) {
+        ++message.count;
+        return;
+      }
+    }
+
+    Message message;
+    message.source = source;
+    message.type = type;
+    message.id = id;
+    message.count = 1;
+    message.text = length < 0 ? std::string(text) : std::string(text, length);
+    g_messages.push_back(message);
+    if (take_log_line()) {
+      fprintf(stderr, "GL %s: %s\n", type_name(type), message.text.c_str());
+    }
+  }
+
+  void label(GLenum identifier, GLuint id, const char* text) {
+    if (g_object_label && id != 0) {
+      g_object_label(identifier, id, -1, text);
+    }
+  }
+}
+
+bool gl_debug_install(GLADloadproc load) {
+  bool core = GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3);
+  if (!core && !have_gl_extension("GL_KHR_debug")) {
+    fprintf(stderr, "KHR_debug is not supported; GL debug messages are off\n");
+    return false;
+  }
+  DebugMessageCallbackProc message_callback =
+    (DebugMessageCallbackProc)load("glDebugMessageCallback");
+  ObjectLabelProc object_label = (ObjectLabelProc)load("glObjectLabel");
+  if (!message_callback || !object_label) {
+    fprintf(stderr, "KHR_debug entry points are missing; GL debug messages are off\n");
+    return false;
+  }
+
+  GLint flags = 0;
+  glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+  if (!(flags & k_context_flag_debug_bit)) {
+    fprintf(stderr, "Not a debug context; the driver may report little\n");
+  }
+
+  g_object_label = object_label;
+  g_window_begin = Clock::now();
+  memset(&g_counts, 0, sizeof(g_counts));
+  message_callback(on_message, NULL);
+  glEnable(k_debug_output);
+  return true;
+}
+
+bool gl_debug_installed() {
+  return g_object_label != NULL;
+}
+
+void gl_debug_label_buffer(GLuint id, const char* text) {
+  label(k_buffer, id, text);
+}
+
+void gl_debug_label_vertex_array(GLuint id, const char* text) {
+  label(k_vertex_array, id, text);
+}
+
+void gl_debug_label_texture(GLuint id, const char* text) {
+  label(GL_TEXTURE, id, text);
+}
+
+void gl_debug_label_program(GLuint id, const char* text) {
+  label(k_program, id, text);
+}
+
+GlDebugCounts gl_debug_end_frame() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  GlDebugCounts counts = g_counts;
+  memset(&g_counts, 0, sizeof(g_counts));
+  TRACE_COUNTER("gl_performance_warnings", counts.performance);
+  return counts;
+}
+
+void gl_debug_print_summary() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  if (g_messages.empty()) {
+    return;
+  }
+  printf("GL debug messages:\n");
+  for (size_t i = 0; i < g_messages.size(); ++i) {
+    const Message& message = g_messages[i];
+    printf("%8zu  %-12s %s\n", message.count, type_name(message.type),
+      message.text.c_str());
+  }
+}
@@ -0,0 +1,40 @@
+#ifndef GL_DEBUG_H
+#define GL_DEBUG_H
+
+#include <stddef.h>
+#include <glad/glad.h>
+
+// Driver messages through KHR_debug, which the GL 3.3 loader does not cover,
+// so the entry points are loaded here.
+//
+// Drivers only say much in a debug context (--gl-debug). Performance
+// warnings, errors and other messages are counted per frame. Each distinct
+// message (by source, type and id) is logged to stderr the first time it
+// arrives. Repeats are only counted, and no more than k_gl_debug_log_rate
+// lines are written per second. Notifications are ignored.
+
+const size_t k_gl_debug_log_rate = 10;
+
+struct GlDebugCounts {
+  size_t performance;
+  size_t errors;
+  size_t other;
+};
+
+// Installs the message callback if the context has KHR_debug; load looks up
+// GL entry points, as for gladLoadGLLoader.
+bool gl_debug_install(GLADloadproc load);
+bool gl_debug_installed();
+
+// Names an object in driver messages. Does nothing without KHR_debug.
+void gl_debug_label_buffer(GLuint id, const char* label);
+void gl_debug_label_vertex_array(GLuint id, const char* label);
+void gl_debug_label_texture(GLuint id, const char* label);
+void gl_debug_label_program(GLuint id, const char* label);
+
+// The counts since the previous call, which starts a new frame.
+GlDebugCounts gl_debug_end_frame();
+// Every distinct message so far with how often it arrived.
+void gl_debug_print_summary();
+
+#endif
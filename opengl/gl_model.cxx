@@ -1,5 +1,8 @@
+#include <stdio.h>
 #include "glad/glad.h"
+#include "opengl/gl_debug.h"
 #include "opengl/gl_model.h"
+#include "opengl/gpu_memory.h"
 #include "opengl/sample_models.h"
 
 GlModel GlModel::cube() {
@@ -50,18 +53,24 @@ void GlModel::load_buffers(
 
   glBindBuffer(GL_ARRAY_BUFFER, buffer_id_[BUFFER_VERTEX]);
   glBufferData(GL_ARRAY_BUFFER, vbuffer_size, vbuffer, GL_STATIC_DRAW);
+  gpu_memory_track(GPU_OBJECT_BUFFER, buffer_id_[BUFFER_VERTEX],
+    GPU_MEMORY_GEOMETRY, vbuffer_size);
   glVertexAttribPointer(POSITION_VID, 3, GL_FLOAT, GL_FALSE, 0, 0);
   glEnableVertexAttribArray(POSITION_VID);
 
   if (have_normals_) {
     glBindBuffer(GL_ARRAY_BUFFER, buffer_id_[BUFFER_NORMAL]);
     glBufferData(GL_ARRAY_BUFFER, nbuffer_size, nbuffer, GL_STATIC_DRAW);
+    gpu_memory_track(GPU_OBJECT_BUFFER, buffer_id_[BUFFER_NORMAL],
+      GPU_MEMORY_GEOMETRY, nbuffer_size);
     glVertexAttribPointer(NORMAL_VID, 3, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(NORMAL_VID);
   }
 
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer_id_[BUFFER_INDEX]);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, ibuffer_size, ibuffer, GL_STATIC_DRAW);
+  gpu_memory_track(GPU_OBJECT_BUFFER, buffer_id_[BUFFER_INDEX],
+    GPU_MEMORY_GEOMETRY, ibuffer_size);
 
   glBindVertexArray(0);
 
@@ -99,10 +108,24 @@ void GlModel::update_buffers(
 }
 
 void GlModel::cleanup() {
+  for (size_t i = 0; i < buffer_count(); ++i) {
+    gpu_memory_release(GPU_OBJECT_BUFFER, buffer_id_[i]);
+  }
   glDeleteBuffers(buffer_count(), buffer_id_);
   glDeleteVertexArrays(1, &varray_id_);
 }
 
+void GlModel::set_label(const char* label) {
+  const char* const buffer_names[BUFFER_COUNT] = { "vertexes", "indexes", "normals" };
+  char text[256];
+  gl_debug_label_vertex_array(varray_id_, label);
+  for (size_t i = 0; i < buffer_count(); ++i) {
+    snprintf(text, sizeof(text), "%s %s", label, buffer_names[i]);
+    gl_debug_label_buffer(buffer_id_[i], text);
+    gpu_memory_label(GPU_OBJECT_BUFFER, buffer_id_[i], text);
+  }
+}
+
 void GlModel::bind() {
   glBindVertexArray(varray_id_);
 }
@@ -42,6 +42,10 @@ public:
   void import(GLuint varray_id);
   void cleanup();
 
+  // Names the vertex array and buffers in driver debug messages, as
+  // "<label> vertexes" and so on. Call after loading the buffers.
+  void set_label(const char* label);
+
   void bind();
   void draw();
   void draw_instanced(size_t instance_count);
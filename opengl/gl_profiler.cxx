@@ -0,0 +1,228 @@
+#ifdef GRAD_GL_PROFILE
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <glad/glad.h>
+#include "misc/trace.h"
+#include "opengl/gl_profiler.h"
+
+#ifndef GLAD_DEBUG
+#error "GRAD_GL_PROFILE needs the glad debug loader in 3rdparty/glad-debug"
+#endif
+
+namespace {
+  enum EntryKind {
+    ENTRY_PLAIN,
+    ENTRY_BIND_BUFFER,
+    ENTRY_READ_PIXELS,
+  };
+
+  struct CallCounts {
+    uint64_t calls;
+    uint64_t ns;
+    uint64_t syncs;
+  };
+
+  struct EntryPoint {
+    const char* name;
+    EntryKind kind;
+    bool timed;
+    bool syncs;  // every call may wait for the GPU
+    bool reported;
+    CallCounts frame;
+    CallCounts last;
+    CallCounts total;
+  };
+
+  // calls whose name starts with one of these are timed
+  const char* const k_timed_prefixes[] = {
+    "glDraw", "glMultiDraw", "glClear", "glBlitFramebuffer",
+    "glBufferData", "glBufferSubData", "glMapBuffer", "glUnmapBuffer",
+    "glTexImage", "glTexSubImage", "glCompressedTex", "glCopyTex",
+    "glGenerateMipmap", "glReadPixels", "glGet", "glFinish", "glFlush",
+    "glClientWaitSync", "glCompileShader", "glLinkProgram",
+  };
+
+  const char* const k_sync_prefixes[] = {
+    "glGet", "glFinish", "glClientWaitSync",
+  };
+
+  // Entry points are keyed by the address of the name glad passes, which
+  // is the same string literal on every call.
+  const size_t k_slot_count = 1024;
+  int g_slots[k_slot_count];
+  const char* g_slot_names[k_slot_count];
+  std::vector<EntryPoint> g_entries;
+
+  GLuint g_pixel_pack_buffer = 0;
+  uint64_t g_frames = 0;
+  uint64_t g_call_begin_ns = 0;
+
+  uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  bool starts_with_any(const char* name, const char* const* prefixes, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      if (strncmp(name, prefixes[i], strlen(prefixes[i])) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  EntryPoint& entry_point(const char* name) {
+    size_t slot = ((uintptr_t)name >> 3) % k_slot_count;
+    while (g_slot_names[slot] && g_slot_names[slot] != name) {
+      slot = (slot + 1) % k_slot_count;
+    }
+    if (g_slot_names[slot]) {
+      return g_entries[g_slots[slot]];
+    }
+
+    EntryPoint entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.name = name;
+    entry.kind = strcmp(name, "glBindBuffer") == 0 ? ENTRY_BIND_BUFFER
+      : strcmp(name, "glReadPixels") == 0 ? ENTRY_READ_PIXELS
+      : ENTRY_PLAIN;
+    entry.timed = starts_with_any(name, k_timed_prefixes,
+      sizeof(k_timed_prefixes) / sizeof(k_timed_prefixes[0]));
+    entry.syncs = starts_with_any(name, k_sync_prefixes,
+      sizeof(k_sync_prefixes) / sizeof(k_sync_prefixes[0]));
+    g_slot_names[slot] = name;
+    g_slots[slot] = g_entries.size();
+    g_entries.push_back(entry);
+    return g_entries.back();
+  }
+
+  void pre_call(const char* name, void* function, int arg_count, ...) {
+    (void)function; (void)arg_count;
+    EntryPoint& entry = entry_point(name);
+    if (entry.kind == ENTRY_BIND_BUFFER) {
+      va_list args;
+      va_start(args, arg_count);
+      GLenum target = va_arg(args, unsigned);
+      GLuint buffer = va_arg(args, unsigned);
+      va_end(args);
+      if (target == GL_PIXEL_PACK_BUFFER) {
+        g_pixel_pack_buffer = buffer;
+      }
+    }
+    if (entry.timed) {
+      g_call_begin_ns = now_ns();
+    }
+  }
+
+  void post_call(const char* name, void* function, int arg_count, ...) {
+    (void)function; (void)arg_count;
+    EntryPoint& entry = entry_point(name);
+    ++entry.frame.calls;
+    if (entry.timed) {
+      entry.frame.ns += now_ns() - g_call_begin_ns;
+    }
+
+    bool synced = entry.syncs
+      || (entry.kind == ENTRY_READ_PIXELS && g_pixel_pack_buffer == 0);
+    if (!synced) {
+      return;
+    }
+    ++entry.frame.syncs;
+    if (!entry.reported) {
+      entry.reported = true;
+      if (entry.kind == ENTRY_READ_PIXELS) {
+        fprintf(stderr, "GL profiler: glReadPixels without a pixel pack buffer "
+          "waits for the GPU\n");
+      } else {
+        fprintf(stderr, "GL profiler: %s may wait for the GPU\n", name);
+      }
+    }
+  }
+
+  void add(CallCounts* sum, const CallCounts& counts) {
+    sum->calls += counts.calls;
+    sum->ns += counts.ns;
+    sum->syncs += counts.syncs;
+  }
+
+  bool by_time_then_calls(const EntryPoint* a, const EntryPoint* b) {
+    if (a->total.ns != b->total.ns) {
+      return a->total.ns > b->total.ns;
+    }
+    return a->total.calls > b->total.calls;
+  }
+}
+
+void gl_profiler_install() {
+  memset(g_slot_names, 0, sizeof(g_slot_names));
+  g_entries.clear();
+  // the table holds every entry point a GL 3.3 core loader has
+  g_entries.reserve(k_slot_count / 2);
+  g_pixel_pack_buffer = 0;
+  g_frames = 0;
+  glad_set_pre_callback(pre_call);
+  glad_set_post_callback(post_call);
+}
+
+void gl_profiler_end_frame() {
+  CallCounts frame = {0, 0, 0};
+  for (size_t i = 0; i < g_entries.size(); ++i) {
+    EntryPoint& entry = g_entries[i];
+    add(&frame, entry.frame);
+    add(&entry.total, entry.frame);
+    entry.last = entry.frame;
+    memset(&entry.frame, 0, sizeof(entry.frame));
+  }
+  ++g_frames;
+  TRACE_COUNTER("gl_calls", frame.calls);
+  TRACE_COUNTER("gl_sync_calls", frame.syncs);
+}
+
+void gl_profiler_print_summary() {
+  if (g_frames == 0) {
+    return;
+  }
+  std::vector<const EntryPoint*> entries;
+  CallCounts last = {0, 0, 0};
+  CallCounts total = {0, 0, 0};
+  for (size_t i = 0; i < g_entries.size(); ++i) {
+    entries.push_back(&g_entries[i]);
+    add(&last, g_entries[i].last);
+    add(&total, g_entries[i].total);
+  }
+  std::sort(entries.begin(), entries.end(), by_time_then_calls);
+
+  printf("GL calls over %llu frames: %.1f calls, %.1f us timed, %.1f syncs per frame\n",
+    (unsigned long long)g_frames, (double)total.calls / g_frames,
+    total.ns * 1e-3 / g_frames, (double)total.syncs / g_frames);
+  printf("last frame: %llu calls, %.1f us timed, %llu syncs\n",
+    (unsigned long long)last.calls, last.ns * 1e-3, (unsigned long long)last.syncs);
+  printf("%-28s %10s %10s %10s %10s %10s\n",
+    "entry point", "last", "calls/fr", "us/frame", "us/call", "syncs/fr");
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const EntryPoint& entry = *entries[i];
+    if (entry.total.calls == 0) {
+      continue;
+    }
+    double calls = (double)entry.total.calls / g_frames;
+    if (entry.timed) {
+      printf("%-28s %10llu %10.1f %10.2f %10.3f %10.1f\n",
+        entry.name, (unsigned long long)entry.last.calls, calls,
+        entry.total.ns * 1e-3 / g_frames,
+        entry.total.ns * 1e-3 / entry.total.calls,
+        (double)entry.total.syncs / g_frames);
+    } else {
+      printf("%-28s %10llu %10.1f %10s %10s %10.1f\n",
+        entry.name, (unsigned long long)entry.last.calls, calls, "-", "-",
+        (double)entry.total.syncs / g_frames);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef GL_PROFILER_H
+#define GL_PROFILER_H
+
+// Counts every GL call per frame through the pre and post call hooks of
+// glad's debug loader, which the GRAD_GL_PROFILE CMake option builds in
+// place of the plain one. Only then do these functions exist.
+//
+// Calls that tend to dominate driver time (draws, uploads, readbacks,
+// compiles, queries and waits) are timed on the CPU as well. Calls that
+// can make the CPU wait for the GPU are flagged: every glGet*, glFinish,
+// glClientWaitSync, and glReadPixels while no pixel pack buffer is bound.
+// The first time each one is seen it is reported on stderr.
+
+#ifdef GRAD_GL_PROFILE
+
+// Installs the hooks; call after glad has loaded.
+void gl_profiler_install();
+// Closes the current frame's counts.
+void gl_profiler_end_frame();
+// The entry points of the last frame and the average over all frames,
+// ordered by CPU time and then by calls.
+void gl_profiler_print_summary();
+
+#endif
+
+#endif
@@ -0,0 +1,207 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "misc/trace.h"
+#include "opengl/gl_debug.h"
+#include "opengl/gpu_memory.h"
+#include "opengl/opengl_common.h"
+
+const char* const k_gpu_memory_category_names[GPU_MEMORY_CATEGORY_COUNT] = {
+  "geometry",
+  "texture",
+  "render target",
+  "readback",
+  "streaming",
+  "program",
+};
+
+namespace {
+  const GLenum k_program_binary_length = 0x8741;
+
+  struct Allocation {
+    GpuObjectKind kind;
+    GLuint id;
+    GpuMemoryCategory category;
+    size_t bytes;
+    std::string label;
+  };
+
+  std::unordered_map<uint64_t, Allocation> g_allocations;
+  GpuMemoryUsage g_usage[GPU_MEMORY_CATEGORY_COUNT];
+  GpuMemoryUsage g_total;
+  GpuMemoryChurn g_churn;
+  int g_have_program_binary = -1;
+
+  uint64_t key(GpuObjectKind kind, GLuint id) {
+    return (uint64_t)kind << 32 | id;
+  }
+
+  void add(GpuMemoryUsage* usage, size_t bytes) {
+    usage->bytes += bytes;
+    usage->peak_bytes = std::max(usage->peak_bytes, usage->bytes);
+    ++usage->objects;
+  }
+
+  void remove(GpuMemoryUsage* usage, size_t bytes) {
+    usage->bytes -= bytes;
+    --usage->objects;
+  }
+
+  bool by_size(const Allocation* a, const Allocation* b) {
+    return a->bytes > b->bytes;
+  }
+
+  const char* kind_name(GpuObjectKind kind) {
+    switch (kind) {
+      case GPU_OBJECT_BUFFER: return "buffer";
+      case GPU_OBJECT_TEXTURE: return "texture";
+      case GPU_OBJECT_PROGRAM: return "program";
+    }
+    return "object";
+  }
+}
+
+void gpu_memory_track(GpuObjectKind kind, GLuint id,
+                      GpuMemoryCategory category, size_t bytes) {
+  if (id == 0) {
+    return;
+  }
+  std::string label;
+  std::unordered_map<uint64_t, Allocation>::iterator it = g_allocations.find(key(kind, id));
+  if (it != g_allocations.end()) {
+    label = it->second.label;
+    gpu_memory_release(kind, id);
+  }
+
+  Allocation allocation;
+  allocation.kind = kind;
+  allocation.id = id;
+  allocation.category = category;
+  allocation.bytes = bytes;
+  allocation.label = label;
+  g_allocations[key(kind, id)] = allocation;
+
+  add(&g_usage[category], bytes);
+  add(&g_total, bytes);
+  ++g_churn.allocations;
+  g_churn.allocated_bytes += bytes;
+}
+
+void gpu_memory_allocate(GpuObjectKind kind, GLuint id, GpuMemoryCategory category,
+                         size_t bytes, const char* label) {
+  gpu_memory_track(kind, id, category, bytes);
+  if (!label) {
+    return;
+  }
+  switch (kind) {
+    case GPU_OBJECT_BUFFER: gl_debug_label_buffer(id, label); break;
+    case GPU_OBJECT_TEXTURE: gl_debug_label_texture(id, label); break;
+    case GPU_OBJECT_PROGRAM: gl_debug_label_program(id, label); break;
+  }
+  gpu_memory_label(kind, id, label);
+}
+
+void gpu_memory_release(GpuObjectKind kind, GLuint id) {
+  std::unordered_map<uint64_t, Allocation>::iterator it = g_allocations.find(key(kind, id));
+  if (it == g_allocations.end()) {
+    return;
+  }
+  const Allocation& allocation = it->second;
+  remove(&g_usage[allocation.category], allocation.bytes);
+  remove(&g_total, allocation.bytes);
+  ++g_churn.releases;
+  g_churn.released_bytes += allocation.bytes;
+  g_allocations.erase(it);
+}
+
+void gpu_memory_label(GpuObjectKind kind, GLuint id, const char* label) {
+  std::unordered_map<uint64_t, Allocation>::iterator it = g_allocations.find(key(kind, id));
+  if (it != g_allocations.end()) {
+    it->second.label = label;
+  }
+}
+
+size_t gpu_memory_texture_bytes(GLenum internal_format,
+                                size_t width, size_t height, size_t depth) {
+  size_t texel_bytes = 4;
+  switch (internal_format) {
+    case GL_R8: texel_bytes = 1; break;
+    case GL_RG8: case GL_R16F: texel_bytes = 2; break;
+    case GL_RGB8: texel_bytes = 3; break;
+    case GL_RGBA8: case GL_R32F: case GL_RG16F: texel_bytes = 4; break;
+    case GL_RGB16F: texel_bytes = 6; break;
+    case GL_RG32F: case GL_RGBA16F: texel_bytes = 8; break;
+    case GL_RGB32F: texel_bytes = 12; break;
+    case GL_RGBA32F: texel_bytes = 16; break;
+  }
+  return texel_bytes * width * height * depth;
+}
+
+size_t gpu_memory_program_bytes(GLuint program_id) {
+  if (g_have_program_binary < 0) {
+    // core in 4.1; asking a driver without it would raise GL_INVALID_ENUM
+    g_have_program_binary = GLVersion.major > 4
+      || (GLVersion.major == 4 && GLVersion.minor >= 1);
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count && !g_have_program_binary; ++i) {
+      const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+      g_have_program_binary = extension
+        && strcmp(extension, "GL_ARB_get_program_binary") == 0;
+    }
+  }
+  if (!g_have_program_binary || program_id == 0) {
+    return 0;
+  }
+  GLint length = 0;
+  glGetProgramiv(program_id, k_program_binary_length, &length);
+  return length;
+}
+
+GpuMemoryUsage gpu_memory_usage(GpuMemoryCategory category) {
+  return g_usage[category];
+}
+
+GpuMemoryUsage gpu_memory_total() {
+  return g_total;
+}
+
+GpuMemoryChurn gpu_memory_end_frame() {
+  GpuMemoryChurn churn = g_churn;
+  memset(&g_churn, 0, sizeof(g_churn));
+  TRACE_COUNTER("gpu_memory_bytes", g_total.bytes);
+  return churn;
+}
+
+void gpu_memory_print() {
+  char bytes[32];
+  char peak[32];
+  printf("%-16s %8s %12s %12s\n", "gpu memory", "objects", "current", "peak");
+  for (size_t c = 0; c < GPU_MEMORY_CATEGORY_COUNT; ++c) {
+    format_bytes(g_usage[c].bytes, bytes, sizeof(bytes));
+    format_bytes(g_usage[c].peak_bytes, peak, sizeof(peak));
+    printf("%-16s %8zu %12s %12s\n", k_gpu_memory_category_names[c],
+      g_usage[c].objects, bytes, peak);
+  }
+  format_bytes(g_total.bytes, bytes, sizeof(bytes));
+  format_bytes(g_total.peak_bytes, peak, sizeof(peak));
+  printf("%-16s %8zu %12s %12s\n", "total", g_total.objects, bytes, peak);
+
+  std::vector<const Allocation*> allocations;
+  for (std::unordered_map<uint64_t, Allocation>::const_iterator it = g_allocations.begin();
+       it != g_allocations.end(); ++it) {
+    allocations.push_back(&it->second);
+  }
+  std::sort(allocations.begin(), allocations.end(), by_size);
+  for (size_t i = 0; i < allocations.size(); ++i) {
+    const Allocation& allocation = *allocations[i];
+    format_bytes(allocation.bytes, bytes, sizeof(bytes));
+    printf("  %12s  %-14s %-8s %4u  %s\n", bytes,
+      k_gpu_memory_category_names[allocation.category],
+      kind_name(allocation.kind), allocation.id, allocation.label.c_str());
+  }
+}
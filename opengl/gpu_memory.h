@@ -0,0 +1,75 @@
+#ifndef GPU_MEMORY_H
+#define GPU_MEMORY_H
+
+#include <stddef.h>
+#include <glad/glad.h>
+
+// A registry of the video memory our GL objects hold, so scenes can be
+// budgeted against the smaller cards before they run out.
+//
+// Whoever allocates storage for a buffer, texture or program records its
+// size here, and records the release when it is deleted. Sizes are what we
+// asked for: drivers pad and compress, so the real footprint differs a
+// little, and memory the driver owns is not counted. Only call from the
+// thread that owns the GL context.
+
+enum GpuMemoryCategory {
+  GPU_MEMORY_GEOMETRY,       // vertex and index buffers
+  GPU_MEMORY_TEXTURE,        // sampled lookup tables and atlases
+  GPU_MEMORY_RENDER_TARGET,  // textures drawn into
+  GPU_MEMORY_READBACK,       // pixel pack buffers
+  GPU_MEMORY_STREAMING,      // buffers refilled every frame
+  GPU_MEMORY_PROGRAM,        // linked program binaries
+  GPU_MEMORY_CATEGORY_COUNT,
+};
+
+extern const char* const k_gpu_memory_category_names[GPU_MEMORY_CATEGORY_COUNT];
+
+enum GpuObjectKind {
+  GPU_OBJECT_BUFFER,
+  GPU_OBJECT_TEXTURE,
+  GPU_OBJECT_PROGRAM,
+};
+
+struct GpuMemoryUsage {
+  size_t bytes;
+  size_t peak_bytes;
+  size_t objects;
+};
+
+// Allocations and releases since the last gpu_memory_end_frame.
+struct GpuMemoryChurn {
+  size_t allocations;
+  size_t allocated_bytes;
+  size_t releases;
+  size_t released_bytes;
+};
+
+// Records that an object now holds bytes, replacing any earlier record of
+// the same object. Reallocating a buffer or texture counts as a release of
+// the old storage and an allocation of the new.
+void gpu_memory_track(GpuObjectKind kind, GLuint id,
+                      GpuMemoryCategory category, size_t bytes);
+void gpu_memory_release(GpuObjectKind kind, GLuint id);
+// Names a tracked object in gpu_memory_print.
+void gpu_memory_label(GpuObjectKind kind, GLuint id, const char* label);
+// gpu_memory_track, then the object named both in gpu_memory_print and in
+// driver messages (see gl_debug.h), as an allocation site wants. label may
+// be NULL, to leave the names as they are.
+void gpu_memory_allocate(GpuObjectKind kind, GLuint id, GpuMemoryCategory category,
+                         size_t bytes, const char* label);
+
+// Storage for a width x height x depth texture of one mip level.
+size_t gpu_memory_texture_bytes(GLenum internal_format,
+                                size_t width, size_t height, size_t depth);
+// The size of a linked program's binary, or 0 if the driver cannot say.
+size_t gpu_memory_program_bytes(GLuint program_id);
+
+GpuMemoryUsage gpu_memory_usage(GpuMemoryCategory category);
+GpuMemoryUsage gpu_memory_total();
+GpuMemoryChurn gpu_memory_end_frame();
+
+// Totals per category, then every object from largest to smallest.
+void gpu_memory_print();
+
+#endif
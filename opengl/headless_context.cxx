@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <string.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <glad/glad.h>
+#include "opengl/headless_context.h"
+
+namespace {
+  EGLDisplay open_display() {
+    const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (extensions && strstr(extensions, "EGL_MESA_platform_surfaceless")) {
+      PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+      if (get_platform_display) {
+        EGLDisplay display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+          EGL_DEFAULT_DISPLAY, NULL);
+        if (display != EGL_NO_DISPLAY) {
+          return display;
+        }
+      }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+}
+
+bool HeadlessContext::init(bool debug) {
+  EGLDisplay display = open_display();
+  EGLint major, minor;
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+    fprintf(stderr, "EGL initialization failed\n");
+    return false;
+  }
+  display_ = display;
+
+  const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+  if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context")) {
+    fprintf(stderr, "EGL_KHR_surfaceless_context is not supported\n");
+    cleanup();
+    return false;
+  }
+
+  // the context never draws to an EGL surface, so any surface type will do
+  const EGLint config_attributes[] = {
+    EGL_SURFACE_TYPE, 0,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_NONE
+  };
+  EGLConfig config;
+  EGLint config_count = 0;
+  if (!eglChooseConfig(display, config_attributes, &config, 1, &config_count) ||
+      config_count == 0) {
+    fprintf(stderr, "No EGL config supports desktop OpenGL\n");
+    cleanup();
+    return false;
+  }
+
+  if (!eglBindAPI(EGL_OPENGL_API)) {
+    fprintf(stderr, "EGL cannot bind the OpenGL API\n");
+    cleanup();
+    return false;
+  }
+  const EGLint context_attributes[] = {
+    EGL_CONTEXT_MAJOR_VERSION, 3,
+    EGL_CONTEXT_MINOR_VERSION, 3,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+    EGL_NONE
+  };
+  EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT,
+    context_attributes);
+  if (context == EGL_NO_CONTEXT) {
+    fprintf(stderr, "EGL context creation failed: 0x%x\n", eglGetError());
+    cleanup();
+    return false;
+  }
+  context_ = context;
+
+  if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+    fprintf(stderr, "EGL make current failed: 0x%x\n", eglGetError());
+    cleanup();
+    return false;
+  }
+
+  if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress)) {
+    fprintf(stderr, "GLAD initialization failed\n");
+    cleanup();
+    return false;
+  }
+  return true;
+}
+
+void* HeadlessContext::get_proc_address(const char* name) {
+  return (void*)eglGetProcAddress(name);
+}
+
+void HeadlessContext::cleanup() {
+  EGLDisplay display = (EGLDisplay)display_;
+  if (display == EGL_NO_DISPLAY) {
+    return;
+  }
+  eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+  if (context_) {
+    eglDestroyContext(display, (EGLContext)context_);
+  }
+  eglTerminate(display);
+  display_ = 0;
+  context_ = 0;
+}
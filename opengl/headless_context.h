@@ -0,0 +1,33 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+// An OpenGL 3.3 core context without a window or a display server, made
+// current through EGL_MESA_platform_surfaceless where available and the
+// default EGL display otherwise. It has no default framebuffer, so every
+// frame must be drawn into a framebuffer object, and nothing throttles it
+// to a refresh rate.
+//
+// Only built with the GRAD_HEADLESS CMake option.
+class HeadlessContext {
+public:
+  HeadlessContext();
+
+  // Creates the context, makes it current and loads the GL entry points.
+  // A debug context has KHR_debug messages turned on.
+  bool init(bool debug);
+  void cleanup();
+
+  // For loading entry points beyond those glad knows, like gladLoadGLLoader.
+  static void* get_proc_address(const char* name);
+
+private:
+  void* display_;
+  void* context_;
+};
+
+inline HeadlessContext::HeadlessContext()
+  : display_(0)
+  , context_(0)
+{}
+
+#endif
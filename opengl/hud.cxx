@@ -0,0 +1,196 @@
+#include <stddef.h>
+#include <algorithm>
+#include <cmath>
+#include "misc/bitmap_font.h"
+#include "opengl/gl_debug.h"
+#include "opengl/gpu_memory.h"
+#include "opengl/hud.h"
+
+extern const char* const k_shaders_hud_vert;
+extern const char* const k_shaders_hud_frag;
+
+namespace {
+  const size_t k_atlas_columns = 16;
+  // a texel of padding right of and below each glyph keeps neighbours out
+  const size_t k_cell_width = k_glyph_width + 1;
+  const size_t k_cell_height = k_glyph_height + 1;
+}
+
+void Hud::init() {
+  shader_.load_with_fallback("shaders/hud.vert", k_shaders_hud_vert,
+                             "shaders/hud.frag", k_shaders_hud_frag);
+  shader_.set_label("hud");
+  viewport_id_ = shader_.uniform_location("v_viewport");
+  shader_.use();
+  glUniform1i(shader_.uniform_location("f_atlas"), 0);
+
+  size_t width, height;
+  bitmap_font_atlas_size(k_atlas_columns, k_cell_width, k_cell_height, &width, &height);
+  std::vector<unsigned char> texels(width * height);
+  bitmap_font_atlas(k_atlas_columns, k_cell_width, k_cell_height, texels.data());
+  atlas_width_ = width;
+  atlas_height_ = height;
+
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glGenTextures(1, &atlas_id_);
+  glBindTexture(GL_TEXTURE_2D, atlas_id_);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0,
+    GL_RED, GL_UNSIGNED_BYTE, texels.data());
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  gpu_memory_allocate(GPU_OBJECT_TEXTURE, atlas_id_, GPU_MEMORY_TEXTURE,
+    gpu_memory_texture_bytes(GL_R8, width, height, 1), "hud font atlas");
+
+  glGenVertexArrays(1, &varray_id_);
+  glBindVertexArray(varray_id_);
+  glGenBuffers(1, &buffer_id_);
+  glBindBuffer(GL_ARRAY_BUFFER, buffer_id_);
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+    (void*)offsetof(Vertex, position));
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+    (void*)offsetof(Vertex, texcoord));
+  glEnableVertexAttribArray(2);
+  glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex),
+    (void*)offsetof(Vertex, color));
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  gl_debug_label_vertex_array(varray_id_, "hud");
+  // sized on the first draw
+  gpu_memory_allocate(GPU_OBJECT_BUFFER, buffer_id_, GPU_MEMORY_STREAMING, 0, "hud vertexes");
+  buffer_capacity_ = 0;
+}
+
+void Hud::cleanup() {
+  gpu_memory_release(GPU_OBJECT_BUFFER, buffer_id_);
+  gpu_memory_release(GPU_OBJECT_TEXTURE, atlas_id_);
+  glDeleteBuffers(1, &buffer_id_);
+  glDeleteVertexArrays(1, &varray_id_);
+  glDeleteTextures(1, &atlas_id_);
+  shader_.destroy();
+  buffer_id_ = 0;
+  varray_id_ = 0;
+  atlas_id_ = 0;
+  buffer_capacity_ = 0;
+  vertexes_.clear();
+}
+
+void Hud::clear() {
+  vertexes_.clear();
+}
+
+float Hud::glyph_advance() const {
+  return k_cell_width * scale_;
+}
+
+float Hud::line_height() const {
+  return (k_cell_height + 1) * scale_;
+}
+
+void Hud::quad(float x0, float y0, float x1, float y1,
+               float u0, float v0, float u1, float v1, uint32_t color) {
+  Vertex corners[4] = {
+    { {x0, y0}, {u0, v0}, {0, 0, 0, 0} },
+    { {x1, y0}, {u1, v0}, {0, 0, 0, 0} },
+    { {x0, y1}, {u0, v1}, {0, 0, 0, 0} },
+    { {x1, y1}, {u1, v1}, {0, 0, 0, 0} },
+  };
+  for (size_t i = 0; i < 4; ++i) {
+    corners[i].color[0] = color >> 24;
+    corners[i].color[1] = color >> 16;
+    corners[i].color[2] = color >> 8;
+    corners[i].color[3] = color;
+  }
+  const size_t order[6] = { 0, 2, 1, 1, 2, 3 };
+  for (size_t i = 0; i < 6; ++i) {
+    vertexes_.push_back(corners[order[i]]);
+  }
+}
+
+void Hud::solid(float x0, float y0, float x1, float y1, uint32_t color) {
+  // the middle of the solid glyph, away from the padding
+  size_t g = k_glyph_solid - k_glyph_first;
+  float u = (g % k_atlas_columns * k_cell_width + 2.5f) / atlas_width_;
+  float v = (g / k_atlas_columns * k_cell_height + 3.5f) / atlas_height_;
+  quad(x0, y0, x1, y1, u, v, u, v, color);
+}
+
+void Hud::text(float x, float y, const char* str, uint32_t color) {
+  float pen_x = x;
+  for (const char* c = str; *c; ++c) {
+    if (*c == '\n') {
+      pen_x = x;
+      y += line_height();
+      continue;
+    }
+    if (*c != ' ') {
+      int g = *c - k_glyph_first;
+      if (g < 0 || g >= (int)k_glyph_count) {
+        g = '?' - k_glyph_first;
+      }
+      float u0 = g % k_atlas_columns * k_cell_width;
+      float v0 = g / k_atlas_columns * k_cell_height;
+      quad(pen_x, y, pen_x + k_glyph_width * scale_, y + k_glyph_height * scale_,
+        u0 / atlas_width_, v0 / atlas_height_,
+        (u0 + k_glyph_width) / atlas_width_, (v0 + k_glyph_height) / atlas_height_,
+        color);
+    }
+    pen_x += glyph_advance();
+  }
+}
+
+void Hud::box(float x, float y, float width, float height, uint32_t color) {
+  solid(x, y, x + width, y + height, color);
+}
+
+void Hud::graph(float x, float y, float width, float height,
+                const float* values, size_t count, float scale, uint32_t color) {
+  if (count == 0 || scale <= 0) {
+    return;
+  }
+  float bar_width = width / count;
+  for (size_t i = 0; i < count; ++i) {
+    if (std::isnan(values[i])) {
+      continue;
+    }
+    float bar_height = std::min(values[i] / scale, 1.f) * height;
+    float x0 = x + i * bar_width;
+    solid(x0, y + height - bar_height, x0 + bar_width, y + height, color);
+  }
+}
+
+void Hud::draw(GLsizei viewport_width, GLsizei viewport_height) {
+  if (vertexes_.empty()) {
+    return;
+  }
+
+  // orphan the buffer every frame so the driver never waits for the last draw
+  glBindBuffer(GL_ARRAY_BUFFER, buffer_id_);
+  size_t bytes = vertexes_.size() * sizeof(Vertex);
+  if (bytes > buffer_capacity_) {
+    buffer_capacity_ = 2 * bytes;
+    // orphaning at the same size is not churn, so only growth is recorded
+    gpu_memory_track(GPU_OBJECT_BUFFER, buffer_id_, GPU_MEMORY_STREAMING, buffer_capacity_);
+  }
+  glBufferData(GL_ARRAY_BUFFER, buffer_capacity_, NULL, GL_STREAM_DRAW);
+  glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, vertexes_.data());
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glEnable(GL_BLEND);
+  glBlendEquation(GL_FUNC_ADD);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  shader_.use();
+  glUniform2f(viewport_id_, viewport_width, viewport_height);
+  glActiveTexture(GL_TEXTURE0 + 0);
+  glBindTexture(GL_TEXTURE_2D, atlas_id_);
+  glBindVertexArray(varray_id_);
+  glDrawArrays(GL_TRIANGLES, 0, vertexes_.size());
+  glBindVertexArray(0);
+  glDisable(GL_BLEND);
+}
@@ -0,0 +1,73 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <stdint.h>
+#include <vector>
+#include <glad/glad.h>
+#include "opengl/shader_program.h"
+
+// A batched overlay of text, boxes and bar graphs in window pixels, with
+// (0, 0) at the top-left corner.
+//
+// Everything added between clear() and draw() is built into one vertex
+// buffer on the CPU, textured from a single font atlas whose solid glyph
+// doubles as the texel for boxes and bars, and drawn with one call.
+// Colours are 0xRRGGBBAA.
+class Hud {
+public:
+  Hud();
+
+  void init();
+  void cleanup();
+
+  void clear();
+  // Draws str with its top-left corner at (x, y); '\n' starts a new line.
+  void text(float x, float y, const char* str, uint32_t color);
+  void box(float x, float y, float width, float height, uint32_t color);
+  // One bar per value, from the bottom of the box up to value / scale of
+  // its height. NaN values leave a gap.
+  void graph(float x, float y, float width, float height,
+             const float* values, size_t count, float scale, uint32_t color);
+
+  void draw(GLsizei viewport_width, GLsizei viewport_height);
+
+  float glyph_advance() const;
+  float line_height() const;
+
+private:
+  struct Vertex {
+    float position[2];
+    float texcoord[2];
+    uint8_t color[4];
+  };
+
+  void quad(float x0, float y0, float x1, float y1,
+            float u0, float v0, float u1, float v1, uint32_t color);
+  void solid(float x0, float y0, float x1, float y1, uint32_t color);
+
+private:
+  ShaderProgram shader_;
+  GLint viewport_id_;
+  GLuint atlas_id_;
+  GLuint varray_id_;
+  GLuint buffer_id_;
+  size_t buffer_capacity_;
+  float atlas_width_;
+  float atlas_height_;
+  float scale_;
+
+  std::vector<Vertex> vertexes_;
+};
+
+inline Hud::Hud()
+  : viewport_id_(-1)
+  , atlas_id_(0)
+  , varray_id_(0)
+  , buffer_id_(0)
+  , buffer_capacity_(0)
+  , atlas_width_(1)
+  , atlas_height_(1)
+  , scale_(2)
+{}
+
+#endif
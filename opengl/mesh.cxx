@@ -2,22 +2,44 @@
 #include <cmath>
 #include <map>
 #include <ostream>
+#include "misc/cpu_dispatch.h"
+#include "misc/trace.h"
 #include "opengl/mesh.h"
 
 namespace {
-  inline vec3f triangle_normal(
-    const vec3f& a, const vec3f& b, const vec3f& c) {
-    vec3f ab = b - a;
-    vec3f ac = c - a;
-    return normalized(cross(ab, ac));
+  void calculate_face_normals(Mesh* mesh) {
+    if (!mesh->face_normals.empty()) {
+      cpu_kernels().face_normals(mesh->vertexes[0].data(), &mesh->indexes[0],
+        mesh->face_normals.size(), mesh->face_normals[0].data());
+    }
   }
 
   inline float triangle_angle(
-    const vec3f& a, const vec3f& b, const vec3f& c) {
+    const vec3f& a, const vec3f& b, const vec3f& c, MathPrecision precision) {
     vec3f ab = b - a;
     vec3f ac = c - a;
+    if (precision == MATH_FAST) {
+      // one reciprocal square root per length, as their product would
+      // leave the range of a float for edges below 3e-10 or above 4e9
+      float cosine = dot(ab, ac)
+        * rsqrtf_fast(magnitude_sq(ab)) * rsqrtf_fast(magnitude_sq(ac));
+      return acosf_fast(std::min(std::max(cosine, -1.f), 1.f));
+    }
     return std::acos(dot(ab, ac) / (magnitude(ab) * magnitude(ac)));
   }
+
+  void normalize_all(std::vector<vec3f>* vectors, MathPrecision precision) {
+    std::vector<vec3f>& v = *vectors;
+    if (precision == MATH_FAST) {
+      for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = normalized_fast(v[i]);
+      }
+    } else {
+      for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = normalized(v[i]);
+      }
+    }
+  }
 }
 
 void Mesh::clear() {
@@ -28,20 +50,23 @@ void Mesh::clear() {
 }
 
 void Mesh::calculate_normals() {
+  calculate_normals(MATH_PRECISE);
+}
+
+void Mesh::calculate_normals(MathPrecision precision) {
+  TRACE_ZONE("Mesh::calculate_normals");
   face_normals.resize(indexes.size()/3u);
   vertex_normals.resize(vertexes.size());
 
-  // calculate face normals and collect data for vertex normals
-  // also calculate face centers
+  // calculate face normals, then collect them for vertex normals
+  calculate_face_normals(this);
   std::fill(vertex_normals.begin(), vertex_normals.end(), vec3f(0,0,0));
   for (size_t i = 0u; i < face_normals.size(); ++i) {
     unsigned int i1 = indexes[3*i];
     unsigned int i2 = indexes[3*i + 1];
     unsigned int i3 = indexes[3*i + 2];
 
-    vec3f normal = -triangle_normal(
-      vertexes[i1], vertexes[i2], vertexes[i3]);
-    face_normals[i] = normal;
+    const vec3f& normal = face_normals[i];
 
     // associate this face normal with each vertex
     vertex_normals[i1] += normal;
@@ -49,32 +74,34 @@ void Mesh::calculate_normals() {
     vertex_normals[i3] += normal;
   }
 
-  std::transform(vertex_normals.begin(), vertex_normals.end(),
-    vertex_normals.begin(), normalized);
+  normalize_all(&vertex_normals, precision);
 }
 
 void Mesh::calculate_weighted_normals() {
+  calculate_weighted_normals(MATH_PRECISE);
+}
+
+void Mesh::calculate_weighted_normals(MathPrecision precision) {
+  TRACE_ZONE("Mesh::calculate_weighted_normals");
   face_normals.resize(indexes.size()/3u);
   vertex_normals.resize(vertexes.size());
 
-  // calculate face normals and collect data for vertex normals
-  // also calculate face centers
+  // calculate face normals, then collect them for vertex normals
+  calculate_face_normals(this);
   std::fill(vertex_normals.begin(), vertex_normals.end(), vec3f(0,0,0));
   for (size_t i = 0u; i < face_normals.size(); ++i) {
     unsigned int i1 = indexes[3*i];
     unsigned int i2 = indexes[3*i + 1];
     unsigned int i3 = indexes[3*i + 2];
 
-    vec3f normal = -triangle_normal(
-      vertexes[i1], vertexes[i2], vertexes[i3]);
-    face_normals[i] = normal;
+    const vec3f& normal = face_normals[i];
 
     float w1 = triangle_angle(
-      vertexes[i1], vertexes[i2], vertexes[i3]);
+      vertexes[i1], vertexes[i2], vertexes[i3], precision);
     float w2 = triangle_angle(
-      vertexes[i2], vertexes[i3], vertexes[i1]);
+      vertexes[i2], vertexes[i3], vertexes[i1], precision);
     float w3 = triangle_angle(
-      vertexes[i3], vertexes[i1], vertexes[i2]);
+      vertexes[i3], vertexes[i1], vertexes[i2], precision);
 
     // associate this face normal with each vertex
     vertex_normals[i1] += w1 * normal;
@@ -82,8 +109,7 @@ void Mesh::calculate_weighted_normals() {
     vertex_normals[i3] += w3 * normal;
   }
 
-  std::transform(vertex_normals.begin(), vertex_normals.end(),
-    vertex_normals.begin(), normalized);
+  normalize_all(&vertex_normals, precision);
 }
 
 namespace {
@@ -95,6 +121,7 @@ namespace {
 }
 
 void Mesh::simplify() {
+  TRACE_ZONE("Mesh::simplify");
   // find all our duplicates and drop them into a
   // duplicate to original map
   std::map<size_t,size_t> duplicates;
@@ -145,6 +172,7 @@ void Mesh::simplify() {
 }
 
 void Mesh::export_to_obj(std::ostream& out) const {
+  TRACE_ZONE("Mesh::export_to_obj");
   for (vec3f v : this->vertexes) {
     out << "v " << v[0] << " " << v[1] << " " << v[2] << "\n";
   }
@@ -158,6 +186,7 @@ void Mesh::export_to_obj(std::ostream& out) const {
 }
 
 Box Mesh::get_bounding_box() const {
+  TRACE_ZONE("Mesh::get_bounding_box");
   Box box;
   if (vertexes.empty()) {
     box.min_corner = vec3f{0,0,0};
@@ -165,16 +194,7 @@ Box Mesh::get_bounding_box() const {
     return box;
   }
 
-  box.min_corner = vertexes[0];
-  box.max_corner = vertexes[0];
-  for (vec3f v : vertexes) {
-    for (int i = 0; i < 3; ++i) {
-      if (v[i] < box.min_corner[i]) {
-        box.min_corner[i] = v[i];
-      } else if (v[i] > box.max_corner[i]) {
-        box.max_corner[i] = v[i];
-      }
-    }
-  }
+  cpu_kernels().bounding_box(vertexes[0].data(), vertexes.size(),
+    box.min_corner.data(), box.max_corner.data());
   return box;
 }
@@ -28,6 +28,10 @@ struct Mesh {
   void clear();
   void calculate_normals();
   void calculate_weighted_normals();
+  // With MATH_FAST the angle weights and the normalisation use the _fast
+  // functions of vector_math.h; the normals move by less than 1e-4.
+  void calculate_normals(MathPrecision precision);
+  void calculate_weighted_normals(MathPrecision precision);
   void export_to_obj(std::ostream& os) const;
   Box get_bounding_box() const;
   void simplify();
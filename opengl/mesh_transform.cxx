@@ -0,0 +1,160 @@
+#include <algorithm>
+#include "misc/cpu_dispatch.h"
+#include "misc/thread_pool.h"
+#include "misc/trace.h"
+#include "opengl/mesh_transform.h"
+
+namespace {
+  // A 3x4 row-major affine transform: the rotation and scale in the first
+  // three columns, the translation in the last.
+  struct AffineTask {
+    float m[12];
+    bool normalize;
+    const float* in;
+    float* out;
+    size_t count;
+  };
+
+  const size_t k_transform_chunk = 16384;
+
+  void transform_chunk(void* context, size_t index) {
+    const AffineTask& task = *(const AffineTask*)context;
+    size_t begin = index * k_transform_chunk;
+    size_t end = std::min(begin + k_transform_chunk, task.count);
+    const CpuKernels& kernels = cpu_kernels();
+    (task.normalize ? kernels.transform_normals : kernels.transform_points)(
+      task.m, task.in + 3*begin, end - begin, task.out + 3*begin);
+  }
+
+  void transform_affine(const float* m, bool normalize,
+                        const vec3f* in, size_t count, vec3f* out,
+                        ThreadPool* pool) {
+    AffineTask task;
+    std::copy(m, m + 12, task.m);
+    task.normalize = normalize;
+    task.in = in->data();
+    task.out = out->data();
+    task.count = count;
+    run_chunks(pool, transform_chunk, &task, count, k_transform_chunk);
+  }
+
+  // the upper 3x4 of a mat4f
+  void affine_from_mat4f(const mat4f& m, float* out) {
+    std::copy(&m.data[0], &m.data[0] + 12, out);
+  }
+
+  void affine_from_mat3f(const mat3f& m, float* out) {
+    for (size_t row = 0; row < 3; ++row) {
+      out[4*row] = m[3*row];
+      out[4*row + 1] = m[3*row + 1];
+      out[4*row + 2] = m[3*row + 2];
+      out[4*row + 3] = 0;
+    }
+  }
+
+  mat3f rotation_matrix(const quaternion& rotation) {
+    mat4f r = rotation.to_mat4f();
+    return mat3f(r[0], r[1], r[2],
+                 r[4], r[5], r[6],
+                 r[8], r[9], r[10]);
+  }
+
+  void transform_mesh_normals(const mat3f& normals, const Mesh& in, Mesh* out,
+                              ThreadPool* pool) {
+    out->face_normals.resize(in.face_normals.size());
+    out->vertex_normals.resize(in.vertex_normals.size());
+    if (!in.face_normals.empty()) {
+      transform_normals(normals, &in.face_normals[0], in.face_normals.size(),
+        &out->face_normals[0], pool);
+    }
+    if (!in.vertex_normals.empty()) {
+      transform_normals(normals, &in.vertex_normals[0], in.vertex_normals.size(),
+        &out->vertex_normals[0], pool);
+    }
+  }
+
+  void prepare_output(const Mesh& in, Mesh* out) {
+    if (&in != out) {
+      out->indexes = in.indexes;
+      out->vertexes.resize(in.vertexes.size());
+    }
+  }
+}
+
+mat3f normal_matrix(const mat4f& m) {
+  // cofactors of the upper 3x3, which are its inverse transpose times the
+  // determinant
+  float a = m[0], b = m[1], c = m[2];
+  float d = m[4], e = m[5], f = m[6];
+  float g = m[8], h = m[9], i = m[10];
+  mat3f cofactors(e*i - f*h, f*g - d*i, d*h - e*g,
+                  c*h - b*i, a*i - c*g, b*g - a*h,
+                  b*f - c*e, c*d - a*f, a*e - b*d);
+  float det = a*cofactors[0] + b*cofactors[1] + c*cofactors[2];
+  if (det != 0.f) {
+    for (size_t k = 0; k < 9; ++k) {
+      cofactors[k] /= det;
+    }
+  }
+  return cofactors;
+}
+
+void transform_points(const mat4f& m,
+                      const vec3f* in, size_t count, vec3f* out,
+                      ThreadPool* pool) {
+  TRACE_ZONE("transform_points");
+  float affine[12];
+  affine_from_mat4f(m, affine);
+  transform_affine(affine, false, in, count, out, pool);
+}
+
+void transform_points(const quaternion& rotation, const vec3f& translation,
+                      const vec3f* in, size_t count, vec3f* out,
+                      ThreadPool* pool) {
+  TRACE_ZONE("transform_points");
+  float affine[12];
+  affine_from_mat3f(rotation_matrix(rotation), affine);
+  affine[3] = translation[0];
+  affine[7] = translation[1];
+  affine[11] = translation[2];
+  transform_affine(affine, false, in, count, out, pool);
+}
+
+void transform_normals(const mat3f& normal_matrix,
+                       const vec3f* in, size_t count, vec3f* out,
+                       ThreadPool* pool) {
+  TRACE_ZONE("transform_normals");
+  float affine[12];
+  affine_from_mat3f(normal_matrix, affine);
+  transform_affine(affine, true, in, count, out, pool);
+}
+
+void transform_mesh(const mat4f& m, Mesh* mesh, ThreadPool* pool) {
+  transform_mesh(m, *mesh, mesh, pool);
+}
+
+void transform_mesh(const mat4f& m, const Mesh& in, Mesh* out, ThreadPool* pool) {
+  TRACE_ZONE("transform_mesh");
+  prepare_output(in, out);
+  if (!in.vertexes.empty()) {
+    transform_points(m, &in.vertexes[0], in.vertexes.size(), &out->vertexes[0], pool);
+  }
+  transform_mesh_normals(normal_matrix(m), in, out, pool);
+}
+
+void transform_mesh(const quaternion& rotation, const vec3f& translation,
+                    Mesh* mesh, ThreadPool* pool) {
+  transform_mesh(rotation, translation, *mesh, mesh, pool);
+}
+
+void transform_mesh(const quaternion& rotation, const vec3f& translation,
+                    const Mesh& in, Mesh* out, ThreadPool* pool) {
+  TRACE_ZONE("transform_mesh");
+  prepare_output(in, out);
+  if (!in.vertexes.empty()) {
+    transform_points(rotation, translation, &in.vertexes[0], in.vertexes.size(),
+      &out->vertexes[0], pool);
+  }
+  // a rotation is its own normal matrix
+  transform_mesh_normals(rotation_matrix(rotation), in, out, pool);
+}
@@ -0,0 +1,50 @@
+#ifndef MESH_TRANSFORM_H
+#define MESH_TRANSFORM_H
+
+#include <stddef.h>
+#include "math/mat3f.h"
+#include "math/mat4f.h"
+#include "math/quaternion.h"
+#include "math/vec3f.h"
+#include "opengl/mesh.h"
+
+class ThreadPool;
+
+// Transforms whole arrays of points and normals, for baking transforms into
+// static geometry. Points are transformed several at a time in SIMD
+// registers (see cpu_dispatch.h), and arrays larger than a chunk are split
+// across the pool, which may be NULL to run on the calling thread.
+//
+// Transforms given as a mat4f are taken to be affine: the bottom row is
+// ignored and read as 0 0 0 1, which holds for everything built from
+// trans, scale, rotations and quaternions, but not for proj.
+
+// The inverse transpose of the upper 3x3 of m, which keeps normals
+// perpendicular to their surfaces under non-uniform scale. A singular m
+// gives its cofactor matrix, which is the same up to scale.
+mat3f normal_matrix(const mat4f& m);
+
+// out may be the same array as in, but must not otherwise overlap it.
+void transform_points(const mat4f& m,
+                      const vec3f* in, size_t count, vec3f* out,
+                      ThreadPool* pool);
+void transform_points(const quaternion& rotation, const vec3f& translation,
+                      const vec3f* in, size_t count, vec3f* out,
+                      ThreadPool* pool);
+
+// Multiplies by normal_matrix and renormalises. Zero normals stay zero.
+void transform_normals(const mat3f& normal_matrix,
+                       const vec3f* in, size_t count, vec3f* out,
+                       ThreadPool* pool);
+
+// Transforms the vertexes of a mesh, and its face and vertex normals by the
+// normal matrix. The out-of-place versions copy the indexes, and out may be
+// &in.
+void transform_mesh(const mat4f& m, Mesh* mesh, ThreadPool* pool);
+void transform_mesh(const mat4f& m, const Mesh& in, Mesh* out, ThreadPool* pool);
+void transform_mesh(const quaternion& rotation, const vec3f& translation,
+                    Mesh* mesh, ThreadPool* pool);
+void transform_mesh(const quaternion& rotation, const vec3f& translation,
+                    const Mesh& in, Mesh* out, ThreadPool* pool);
+
+#endif
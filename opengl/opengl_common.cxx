@@ -4,9 +4,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include "glad/glad.h"
+#include "misc/trace.h"
 #include "opengl/opengl_common.h"
 
 char* load_file(const char* filename, int* length) {
+  TRACE_ZONE("load_file");
   FILE* f = fopen(filename, "rb");
   char* contents = NULL;
   long fsize = 0; 
@@ -40,6 +42,7 @@ exit:
 }
 
 void compile_shader(GLuint shader_id, const char* shader_name) {
+  TRACE_ZONE("compile_shader");
   glCompileShader(shader_id);
 
   GLint result = GL_FALSE;
@@ -57,6 +60,7 @@ void compile_shader(GLuint shader_id, const char* shader_name) {
 }
 
 void link_program(GLuint program_id) {
+  TRACE_ZONE("link_program");
   glLinkProgram(program_id);
 
   GLint result = GL_FALSE;
@@ -72,18 +76,49 @@ void link_program(GLuint program_id) {
   }
 }
 
+void shader_source_with_defines(GLuint shader_id,
+const char* shader_text, int shader_length, const char* defines) {
+  if (!defines) {
+    glShaderSource(shader_id, 1, (const GLchar**)&shader_text, &shader_length);
+    return;
+  }
+
+  // the defines must follow the #version directive
+  int split = 0;
+  if (strncmp(shader_text, "#version", 8) == 0) {
+    while (split < shader_length && shader_text[split] != '\n') {
+      ++split;
+    }
+    if (split < shader_length) {
+      ++split;
+    }
+  }
+  const char* text_arr[3] = { shader_text, defines, shader_text + split };
+  int length_arr[3] = { split, (int)strlen(defines), shader_length - split };
+  glShaderSource(shader_id, 3, (const GLchar**)text_arr, length_arr);
+}
+
 GLuint load_shaders_from_string(
 const char** shader_text_arr, int* shader_length_arr,
 const char** shader_name_arr, GLenum* shader_type_arr,
 size_t shader_count) {
+  return load_shaders_from_string(shader_text_arr, shader_length_arr,
+    shader_name_arr, shader_type_arr, shader_count, NULL);
+}
+
+GLuint load_shaders_from_string(
+const char** shader_text_arr, int* shader_length_arr,
+const char** shader_name_arr, GLenum* shader_type_arr,
+size_t shader_count, const char* defines) {
+  TRACE_ZONE("load_shaders_from_string");
   GLuint* shaders = (GLuint*)malloc(shader_count*sizeof(GLuint));
   for (size_t i = 0; i < shader_count; ++i) {
     shaders[i] = glCreateShader(shader_type_arr[i]);
   }
 
   for (size_t i = 0; i < shader_count; ++i) {
-    glShaderSource(shaders[i], 1,
-      (const GLchar**)&shader_text_arr[i], &shader_length_arr[i]);
+    shader_source_with_defines(shaders[i],
+      shader_text_arr[i], shader_length_arr[i], defines);
     compile_shader(shaders[i], shader_name_arr[i]);
   }
 
@@ -105,6 +140,7 @@ GLuint load_shaders_from_string(
 const char* vert_shader_text, int vert_shader_length,
 const char* frag_shader_text, int frag_shader_length,
 const char* vertex_shader_name, const char* fragment_shader_name) {
+  TRACE_ZONE("load_shaders_from_string");
   GLuint vert_shader = glCreateShader(GL_VERTEX_SHADER);
   GLuint frag_shader = glCreateShader(GL_FRAGMENT_SHADER);
 
@@ -132,6 +168,7 @@ const char* vertex_shader_name,
 const char* default_vertex_shader_text,
 const char* fragment_shader_name,
 const char* default_fragment_shader_text) {
+  TRACE_ZONE("load_shaders_with_fallback");
   int vert_shader_length;
   char* loaded_vert_shader_text = load_file(vertex_shader_name, &vert_shader_length);
   const char* vert_shader_text = loaded_vert_shader_text;
@@ -160,9 +197,40 @@ const char* default_fragment_shader_text) {
   return shader;
 }
 
+GLuint load_shaders_with_fallback(
+const char** shader_name_arr, const char** default_shader_text_arr,
+GLenum* shader_type_arr, size_t shader_count, const char* defines) {
+  TRACE_ZONE("load_shaders_with_fallback");
+  char** loaded_text_arr = (char**)malloc(shader_count*sizeof(char*));
+  const char** shader_text_arr = (const char**)malloc(shader_count*sizeof(char*));
+  int* shader_length_arr = (int*)malloc(shader_count*sizeof(int));
+  for (size_t i = 0; i < shader_count; ++i) {
+    loaded_text_arr[i] = load_file(shader_name_arr[i], &shader_length_arr[i]);
+    shader_text_arr[i] = loaded_text_arr[i];
+    if (!shader_text_arr[i]) {
+      fprintf(stderr, "Using default for %s\n", shader_name_arr[i]);
+      shader_text_arr[i] = default_shader_text_arr[i];
+      shader_length_arr[i] = strlen(default_shader_text_arr[i]);
+    }
+  }
+
+  GLuint shader = load_shaders_from_string(shader_text_arr, shader_length_arr,
+    shader_name_arr, shader_type_arr, shader_count, defines);
+
+  for (size_t i = 0; i < shader_count; ++i) {
+    free(loaded_text_arr[i]);
+  }
+  free(shader_length_arr);
+  free(shader_text_arr);
+  free(loaded_text_arr);
+
+  return shader;
+}
+
 GLuint load_shaders(
 const char* vertex_shader_name,
 const char* fragment_shader_name) {
+  TRACE_ZONE("load_shaders");
   int vert_shader_length;
   char* vert_shader_text = load_file(vertex_shader_name, &vert_shader_length);
   if (!vert_shader_text) {
@@ -189,6 +257,7 @@ GLuint load_shaders(
 const char* vertex_shader_name,
 const char* fragment_shader_name,
 const char* geometry_shader_name) {
+  TRACE_ZONE("load_shaders");
   int vert_shader_length;
   char* vert_shader_text = load_file(vertex_shader_name, &vert_shader_length);
   if (!vert_shader_text) {
@@ -251,3 +320,25 @@ int check_version_string(const char* name, const char* version,
   }
   return 0;
 }
+
+bool have_gl_extension(const char* name) {
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; ++i) {
+    const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+    if (extension && strcmp(extension, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void format_bytes(double bytes, char* out, size_t size) {
+  if (bytes >= 1024 * 1024) {
+    snprintf(out, size, "%.1f MB", bytes / (1024 * 1024));
+  } else if (bytes >= 1024) {
+    snprintf(out, size, "%.1f KB", bytes / 1024);
+  } else {
+    snprintf(out, size, "%.0f B", bytes);
+  }
+}
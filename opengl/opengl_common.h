@@ -1,6 +1,7 @@
 #ifndef OPENGL_COMMON_H
 #define OPENGL_COMMON_H
 
+#include <stddef.h>
 #include <GL/gl.h>
 
 char* load_file(
@@ -34,6 +35,14 @@ GLuint load_shaders_with_fallback(
   const char* default_fragment_shader_text
 );
 
+GLuint load_shaders_with_fallback(
+  const char** shader_name_arr,
+  const char** default_shader_text_arr,
+  GLenum* shader_type_arr,
+  size_t shader_count,
+  const char* defines
+);
+
 GLuint load_shaders_from_string(
   const char* vert_shader_text, int vert_shader_length,
   const char* frag_shader_text, int frag_shader_length,
@@ -46,6 +55,19 @@ GLuint load_shaders_from_string(
   size_t shader_count
 );
 
+GLuint load_shaders_from_string(
+  const char** shader_text_arr, int* shader_length_arr,
+  const char** shader_name_arr, GLenum* shaderType,
+  size_t shader_count, const char* defines
+);
+
+void shader_source_with_defines(
+  GLuint shader_id,
+  const char* shader_text,
+  int shader_length,
+  const char* defines
+);
+
 int check_version_string(
   const char* name,
   const char* version,
@@ -54,4 +76,10 @@ int check_version_string(
   const char* version_req
 );
 
+// Whether the current context lists the extension.
+bool have_gl_extension(const char* name);
+
+// bytes as "12 B", "3.4 KB" or "5.6 MB", for reports and the HUD
+void format_bytes(double bytes, char* out, size_t size);
+
 #endif
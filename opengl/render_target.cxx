@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include "opengl/gl_debug.h"
+#include "opengl/gpu_memory.h"
+#include "opengl/render_target.h"
+
+GLuint RenderTarget::default_framebuffer_id_ = 0;
+
+void RenderTarget::init(GLenum internal_format) {
+  internal_format_ = internal_format;
+  glGenFramebuffers(1, &framebuffer_id_);
+  glGenTextures(1, &texture_id_);
+}
+
+void RenderTarget::resize(GLsizei width, GLsizei height) {
+  if (width == width_ && height == height_) {
+    return;
+  }
+  width_ = width;
+  height_ = height;
+
+  glBindTexture(GL_TEXTURE_2D, texture_id_);
+  glTexImage2D(GL_TEXTURE_2D, 0, internal_format_, width, height, 0,
+    GL_RED, GL_FLOAT, NULL);
+  gpu_memory_allocate(GPU_OBJECT_TEXTURE, texture_id_, GPU_MEMORY_RENDER_TARGET,
+    gpu_memory_texture_bytes(internal_format_, width, height, 1), label_);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_id_);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+    GL_TEXTURE_2D, texture_id_, 0);
+  GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    fprintf(stderr, "Render target incomplete: 0x%x\n", status);
+  }
+  unbind();
+}
+
+void RenderTarget::cleanup() {
+  glDeleteFramebuffers(1, &framebuffer_id_);
+  gpu_memory_release(GPU_OBJECT_TEXTURE, texture_id_);
+  glDeleteTextures(1, &texture_id_);
+  framebuffer_id_ = 0;
+  texture_id_ = 0;
+  width_ = 0;
+  height_ = 0;
+}
+
+void RenderTarget::set_label(const char* label) {
+  label_ = label;
+  if (width_ > 0) {
+    gl_debug_label_texture(texture_id_, label_);
+    gpu_memory_label(GPU_OBJECT_TEXTURE, texture_id_, label_);
+  }
+}
+
+void RenderTarget::bind() {
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_id_);
+  glViewport(0, 0, width_, height_);
+}
+
+void RenderTarget::unbind() {
+  glBindFramebuffer(GL_FRAMEBUFFER, default_framebuffer_id_);
+}
+
+void RenderTarget::set_default_framebuffer(GLuint framebuffer_id) {
+  default_framebuffer_id_ = framebuffer_id;
+}
@@ -0,0 +1,66 @@
+#ifndef RENDER_TARGET_H
+#define RENDER_TARGET_H
+
+#include <glad/glad.h>
+
+// An offscreen colour target, for accumulating scalar fields or for drawing
+// whole frames without a window.
+class RenderTarget {
+public:
+  RenderTarget();
+
+  void init(GLenum internal_format);
+  void resize(GLsizei width, GLsizei height);
+  void cleanup();
+  // names the texture in driver debug messages and the memory registry;
+  // the label must outlive the target
+  void set_label(const char* label);
+
+  void bind();
+  // binds the default framebuffer, which is the window's unless replaced
+  static void unbind();
+  static void set_default_framebuffer(GLuint framebuffer_id);
+
+  GLuint framebuffer() const;
+  GLuint texture() const;
+  GLsizei width() const;
+  GLsizei height() const;
+
+private:
+  GLuint framebuffer_id_;
+  GLuint texture_id_;
+  GLenum internal_format_;
+  GLsizei width_;
+  GLsizei height_;
+  const char* label_;
+
+  static GLuint default_framebuffer_id_;
+};
+
+inline RenderTarget::RenderTarget()
+  : framebuffer_id_(0)
+  , texture_id_(0)
+  , internal_format_(GL_R32F)
+  , width_(0)
+  , height_(0)
+  , label_(NULL)
+{
+}
+
+inline GLuint RenderTarget::framebuffer() const {
+  return framebuffer_id_;
+}
+
+inline GLuint RenderTarget::texture() const {
+  return texture_id_;
+}
+
+inline GLsizei RenderTarget::width() const {
+  return width_;
+}
+
+inline GLsizei RenderTarget::height() const {
+  return height_;
+}
+
+#endif
@@ -31,59 +31,93 @@ namespace cube {
 }
 
 namespace sphere {
-  inline Mesh generate(float radius, size_t quality) {
-    assert(quality > 2);
+  // The sizes of a sphere of the given quality, which generate() doubles.
+  constexpr size_t vertex_count(size_t quality) {
+    return 2 + (2*quality - 1) * (2*quality);
+  }
+
+  constexpr size_t index_count(size_t quality) {
+    return 6 * (2*quality) * (2*quality - 1);
+  }
+
+  // Writes vertex_count(quality) vertexes and index_count(quality) indexes.
+  constexpr void fill(float radius, size_t quality, vec3f* vertexes,
+                      unsigned* indexes) {
     quality *= 2; // indexing algorithm is buggy for odd quality values
-    Mesh m;
 
     // calculate vertexes
-    m.vertexes.push_back(vec3f(0, radius, 0));
+    size_t v = 0;
+    vertexes[v++] = vec3f(0, radius, 0);
     for (size_t i = 1; i < quality; ++i) {
       float fi = i/(float)quality;
       for (size_t j = 0; j < quality; ++j) {
         float fj = j/(float)quality;
-        float cfi = std::cos(M_PI*fi);
-        float sfi = std::sin(M_PI*fi);
-        float cfj = std::cos(2*M_PI*fj);
-        float sfj = std::sin(2*M_PI*fj);
+        float cfi = vector_math_cos(M_PI*fi);
+        float sfi = vector_math_sin(M_PI*fi);
+        float cfj = vector_math_cos(2*M_PI*fj);
+        float sfj = vector_math_sin(2*M_PI*fj);
         vec3f point(radius * sfi * cfj, radius * cfi, radius * sfi * sfj);
-        m.vertexes.push_back(point);
+        vertexes[v++] = point;
       }
     }
-    m.vertexes.push_back(vec3f(0, -radius, 0));
+    vertexes[v++] = vec3f(0, -radius, 0);
 
     // calculate indexes
     size_t num_col = quality;
     size_t num_row = quality;
     size_t last_row = num_row - 1;
-    unsigned int last_vert = m.vertexes.size() - 1;
+    unsigned int last_vert = v - 1;
+    size_t n = 0;
     for (size_t row = 0; row < num_row; ++row) {
       for (size_t col = 0; col < num_col; ++col) {
         size_t r = row - 1; // first row doesn't take up a full column
         if (row != last_row) {
           if (row == 0) {
-            m.indexes.push_back(0);
+            indexes[n++] = 0;
           } else {
-            m.indexes.push_back(r * num_col + 1 + col);
+            indexes[n++] = r * num_col + 1 + col;
           }
-          m.indexes.push_back((r + 1) * num_col + 1 + col);
-          m.indexes.push_back((r + 1) * num_col + 1 + (col + 1) % num_col);
+          indexes[n++] = (r + 1) * num_col + 1 + col;
+          indexes[n++] = (r + 1) * num_col + 1 + (col + 1) % num_col;
         }
 
         if (row != 0) {
-          m.indexes.push_back(r * num_col + 1 + col);
+          indexes[n++] = r * num_col + 1 + col;
           if (row == last_row) {
-            m.indexes.push_back(last_vert);
+            indexes[n++] = last_vert;
           } else {
-            m.indexes.push_back((r + 1) * num_col + 1 + (col + 1) % num_col);
+            indexes[n++] = (r + 1) * num_col + 1 + (col + 1) % num_col;
           }
-          m.indexes.push_back(r * num_col + 1 + (col + 1) % num_col);
+          indexes[n++] = r * num_col + 1 + (col + 1) % num_col;
         }
       }
     }
+  }
 
+  inline Mesh generate(float radius, size_t quality) {
+    assert(quality > 2);
+    Mesh m;
+    m.vertexes.resize(vertex_count(quality));
+    m.indexes.resize(index_count(quality));
+    fill(radius, quality, m.vertexes.data(), m.indexes.data());
     return m;
   }
+
+  // The mesh of generate() as arrays worked out at compile time, as in
+  //   constexpr sphere::Table<13> k_sphere = sphere::table<13>(1.f);
+  template <size_t Quality>
+  struct Table {
+    vec3f vertexes[vertex_count(Quality)];
+    unsigned indexes[index_count(Quality)];
+  };
+
+  template <size_t Quality>
+  constexpr Table<Quality> table(float radius) {
+    static_assert(Quality > 2, "generate() needs a quality above 2");
+    Table<Quality> t{};
+    fill(radius, Quality, t.vertexes, t.indexes);
+    return t;
+  }
 }
 
 #endif
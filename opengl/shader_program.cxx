@@ -1,4 +1,6 @@
 #include "opengl/shader_program.h"
+#include "opengl/gl_debug.h"
+#include "opengl/gpu_memory.h"
 #include "opengl/opengl_common.h"
 
 ShaderProgram::ShaderProgram()
@@ -8,16 +10,25 @@ ShaderProgram::ShaderProgram()
 
 void ShaderProgram::load(const char* vertex, const char* fragment) {
   program_id_ = load_shaders(vertex, fragment);
+  track();
 }
 
 void ShaderProgram::load(const char* vertex, const char* fragment, const char* geometry) {
   program_id_ = load_shaders(vertex, fragment, geometry);
+  track();
 }
 
 void ShaderProgram::load_with_fallback(const char* vertex, const char* vertex_fallback,
   const char* fragment, const char* fragment_fallback) {
   program_id_ = load_shaders_with_fallback(
     vertex, vertex_fallback, fragment, fragment_fallback);
+  track();
+}
+
+void ShaderProgram::load_with_fallback(const char** names, const char** fallbacks,
+  GLenum* types, size_t count, const char* defines) {
+  program_id_ = load_shaders_with_fallback(names, fallbacks, types, count, defines);
+  track();
 }
 
 void ShaderProgram::load_text(const char* vertex, int vertex_size,
@@ -29,6 +40,7 @@ void ShaderProgram::load_text(const char* vertex, int vertex_size,
   const char* shader_name_arr[2] = { "vertex", "fragment" };
   program_id_ = load_shaders_from_string(shader_text_arr, shader_length_arr,
     shader_name_arr, shader_type_arr, shader_count);
+  track();
 }
 
 void ShaderProgram::load_text(const char* vertex, int vertex_size,
@@ -41,6 +53,11 @@ void ShaderProgram::load_text(const char* vertex, int vertex_size,
   const char* shader_name_arr[3] = { "vertex", "fragment", "geometry" };
   program_id_ = load_shaders_from_string(shader_text_arr, shader_length_arr,
     shader_name_arr, shader_type_arr, shader_count);
+  track();
+}
+
+bool ShaderProgram::is_loaded() const {
+  return program_id_ != 0;
 }
 
 void ShaderProgram::use() const {
@@ -48,10 +65,21 @@ void ShaderProgram::use() const {
 }
 
 void ShaderProgram::destroy() {
+  gpu_memory_release(GPU_OBJECT_PROGRAM, program_id_);
   glDeleteProgram(program_id_);
   program_id_ = 0;
 }
 
+void ShaderProgram::set_label(const char* label) const {
+  gl_debug_label_program(program_id_, label);
+  gpu_memory_label(GPU_OBJECT_PROGRAM, program_id_, label);
+}
+
+void ShaderProgram::track() const {
+  gpu_memory_track(GPU_OBJECT_PROGRAM, program_id_, GPU_MEMORY_PROGRAM,
+    gpu_memory_program_bytes(program_id_));
+}
+
 GLint ShaderProgram::uniform_location(const char* uniform_name) const {
   return glGetUniformLocation(program_id_, uniform_name);
 }
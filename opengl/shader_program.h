@@ -11,13 +11,18 @@ struct ShaderProgram {
   void load(const char* vertex, const char* fragment, const char* geometry);
   void load_with_fallback(const char* vertex, const char* vertex_fallback,
                           const char* fragment, const char* fragment_fallback);
+  void load_with_fallback(const char** names, const char** fallbacks,
+                          GLenum* types, size_t count, const char* defines);
   void load_text(const char* vertex, int vertex_size,
                  const char* fragment, int fragment_size);
   void load_text(const char* vertex, int vertex_size,
                  const char* fragment, int fragment_size,
                  const char* geometry, int geometry_size);
+  bool is_loaded() const;
   void use() const;
   void destroy();
+  // names the program in driver debug messages
+  void set_label(const char* label) const;
 
   GLint uniform_location(const char* uniform_name) const;
   void set_uniform(GLint location, float value) const;
@@ -26,6 +31,9 @@ struct ShaderProgram {
   void set_uniform(GLint location, const vec3f& value) const;
   void set_uniform(GLint location, const vec2f& value) const;
 
+private:
+  void track() const;
+
 private:
   GLuint program_id_;
 };
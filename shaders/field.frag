@@ -0,0 +1,20 @@
+#version 330 core
+
+in vec4 f_position;
+
+uniform vec2 f_line[3];
+
+out float frag_value;
+
+// defined in kernel.glsl
+float field_kernel(vec2 diff);
+
+// gradient.frag without the colormap, for when the field is resolved later
+void main() {
+  vec2 pos = f_position.xy;
+  float value = 0.0;
+  for (int i = 0; i < f_line.length(); ++i) {
+    value += field_kernel(pos - f_line[i]);
+  }
+  frag_value = value;
+}
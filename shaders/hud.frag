@@ -0,0 +1,13 @@
+#version 330 core
+
+uniform sampler2D f_atlas;
+
+in vec2 f_texcoord;
+in vec4 f_color;
+
+out vec4 frag_color;
+
+void main() {
+  float coverage = texture(f_atlas, f_texcoord).r;
+  frag_color = vec4(f_color.rgb, f_color.a * coverage);
+}
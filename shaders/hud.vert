@@ -0,0 +1,18 @@
+#version 330 core
+
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec2 texcoord;
+layout(location = 2) in vec4 color;
+
+uniform vec2 v_viewport;
+
+out vec2 f_texcoord;
+out vec4 f_color;
+
+// positions are in window pixels from the top-left corner
+void main() {
+  vec2 p = position / v_viewport * 2.0 - 1.0;
+  gl_Position = vec4(p.x, -p.y, 0, 1);
+  f_texcoord = texcoord;
+  f_color = color;
+}
@@ -0,0 +1,131 @@
+#version 330 core
+
+// Specialised at load time: the loader defines exactly one of KERNEL_POLY6,
+// KERNEL_SPIKY, KERNEL_VISCOSITY, KERNEL_CUBIC_SPLINE or KERNEL_GAUSSIAN,
+// along with the constants below. See kernel_shader_defines in
+// misc/kernels.cxx, which also holds the matching CPU kernels.
+
+const float k_h = K_H;
+const float k_h_sq = k_h*k_h;
+const float k_norm = K_NORM;
+
+float squared(float x) {
+  return x*x;
+}
+
+float cubed(float x) {
+  return x*x*x;
+}
+
+float length_sq(vec2 x) {
+  return dot(x,x);
+}
+
+#if defined(KERNEL_POLY6)
+
+float kernel_value(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  return k_norm * cubed(k_h_sq - distance_sq);
+}
+
+float kernel_derivative(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  return -6 * k_norm * sqrt(distance_sq) * squared(k_h_sq - distance_sq);
+}
+
+#elif defined(KERNEL_SPIKY)
+
+float kernel_value(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  return k_norm * cubed(k_h - sqrt(distance_sq));
+}
+
+float kernel_derivative(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  return -3 * k_norm * squared(k_h - sqrt(distance_sq));
+}
+
+#elif defined(KERNEL_VISCOSITY)
+
+const float k_min_r = K_VISCOSITY_MIN_R;
+
+float kernel_value(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  float r = max(sqrt(distance_sq), k_min_r);
+  return k_norm * (-cubed(r) / (2*k_h*k_h_sq) + squared(r) / k_h_sq + k_h / (2*r) - 1);
+}
+
+float kernel_derivative(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  float r = max(sqrt(distance_sq), k_min_r);
+  return k_norm * (-3*squared(r) / (2*k_h*k_h_sq) + 2*r / k_h_sq - k_h / (2*squared(r)));
+}
+
+#elif defined(KERNEL_CUBIC_SPLINE)
+
+// support is twice the smoothing length
+const float k_hs = k_h / 2;
+
+float kernel_value(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  float q = sqrt(distance_sq) / k_hs;
+  if (q < 1) {
+    return k_norm * (1 - 1.5*squared(q) + 0.75*cubed(q));
+  }
+  return k_norm * 0.25 * cubed(2 - q);
+}
+
+float kernel_derivative(float distance_sq) {
+  if (distance_sq >= k_h_sq) {
+    return 0.0;
+  }
+  float q = sqrt(distance_sq) / k_hs;
+  if (q < 1) {
+    return k_norm / k_hs * (-3*q + 2.25*squared(q));
+  }
+  return k_norm / k_hs * -0.75 * squared(2 - q);
+}
+
+#elif defined(KERNEL_GAUSSIAN)
+
+// the support is the cut-off radius
+const float sigma_sq = K_SIGMA_SQ;
+
+float kernel_value(float distance_sq) {
+  if (distance_sq > k_h_sq) {
+    return 0.0;
+  }
+  return k_norm * exp(-distance_sq / (2.0 * sigma_sq));
+}
+
+float kernel_derivative(float distance_sq) {
+  return -sqrt(distance_sq) / sigma_sq * kernel_value(distance_sq);
+}
+
+#endif
+
+float field_kernel(vec2 diff) {
+  return kernel_value(length_sq(diff));
+}
+
+vec2 field_kernel_gradient(vec2 diff) {
+  return kernel_derivative(length_sq(diff)) * normalize(diff);
+}
+
+float kernel_support() {
+  return k_h;
+}
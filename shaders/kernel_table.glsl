@@ -0,0 +1,34 @@
+#version 330 core
+
+// A drop-in replacement for kernel.glsl that samples a table baked by
+// misc/kernel_table.cxx instead of evaluating the kernel directly.
+// The table holds the kernel in r and its derivative in g, with texel
+// centres spaced evenly in squared distance out to the support.
+// K_H is defined by the loader, as for kernel.glsl.
+
+uniform sampler1D f_kernel_table;
+
+const float k_h = K_H;
+const float k_h_sq = k_h*k_h;
+
+float length_sq(vec2 x) {
+  return dot(x,x);
+}
+
+vec2 sample_table(float distance_sq) {
+  float size = float(textureSize(f_kernel_table, 0));
+  float x = distance_sq / k_h_sq * (size - 1.0);
+  return texture(f_kernel_table, (x + 0.5) / size).rg;
+}
+
+float field_kernel(vec2 diff) {
+  return sample_table(length_sq(diff)).r;
+}
+
+vec2 field_kernel_gradient(vec2 diff) {
+  return sample_table(length_sq(diff)).g * normalize(diff);
+}
+
+float kernel_support() {
+  return k_h;
+}
@@ -0,0 +1,7 @@
+#version 330 core
+
+out float frag_count;
+
+void main() {
+  frag_count = 1.0;
+}
@@ -0,0 +1,21 @@
+#version 330 core
+
+uniform sampler2D f_range;
+uniform vec2 f_bin_range;
+uniform int f_bin_count;
+
+// One point per texel of the seed level, scattered into its histogram bin.
+void main() {
+  ivec2 size = textureSize(f_range, 0);
+  ivec2 p = ivec2(gl_VertexID % size.x, gl_VertexID / size.x);
+  vec2 range = texelFetch(f_range, p, 0).rg;
+  if (range.x > range.y) {
+    // outside the quad
+    gl_Position = vec4(2, 2, 2, 1);
+    return;
+  }
+  float span = max(f_bin_range.y - f_bin_range.x, 1e-20);
+  float t = clamp((range.x - f_bin_range.x) / span, 0.0, 1.0);
+  float bin = min(floor(t * f_bin_count), f_bin_count - 1.0);
+  gl_Position = vec4((bin + 0.5) / f_bin_count * 2.0 - 1.0, 0, 0, 1);
+}
@@ -0,0 +1,18 @@
+#version 330 core
+
+uniform sampler2D f_range;
+
+out vec2 frag_range;
+
+// Each output texel combines a 2x2 block of the level above.
+void main() {
+  ivec2 size = textureSize(f_range, 0);
+  ivec2 p = 2 * ivec2(gl_FragCoord.xy);
+  ivec2 q = min(p + 1, size - 1);
+  vec2 a = texelFetch(f_range, p, 0).rg;
+  vec2 b = texelFetch(f_range, ivec2(q.x, p.y), 0).rg;
+  vec2 c = texelFetch(f_range, ivec2(p.x, q.y), 0).rg;
+  vec2 d = texelFetch(f_range, q, 0).rg;
+  frag_range = vec2(min(min(a.x, b.x), min(c.x, d.x)),
+                    max(max(a.y, b.y), max(c.y, d.y)));
+}
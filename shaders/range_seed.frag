@@ -0,0 +1,12 @@
+#version 330 core
+
+uniform sampler2D f_field;
+
+out vec2 frag_range;
+
+// Copies the field under the quad into (min, max) pairs. Pixels outside the
+// quad keep the clear value, an empty range, so the reduction skips them.
+void main() {
+  float value = texelFetch(f_field, ivec2(gl_FragCoord.xy), 0).r;
+  frag_range = vec2(value, value);
+}
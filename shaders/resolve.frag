@@ -0,0 +1,14 @@
+#version 330 core
+
+uniform sampler2D f_field;
+uniform sampler1DArray f_colormap;
+uniform int f_colormap_layer;
+uniform vec2 f_range;
+
+out vec4 frag_color;
+
+void main() {
+  float value = texelFetch(f_field, ivec2(gl_FragCoord.xy), 0).r;
+  float t = (value - f_range.x) / (f_range.y - f_range.x);
+  frag_color = texture(f_colormap, vec2(t, f_colormap_layer));
+}
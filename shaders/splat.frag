@@ -0,0 +1,12 @@
+#version 330 core
+
+in vec2 f_diff;
+
+out float frag_value;
+
+// defined in kernel.glsl
+float field_kernel(vec2 diff);
+
+void main() {
+  frag_value = field_kernel(f_diff);
+}
@@ -0,0 +1,17 @@
+#version 330 core
+
+layout(location = 0) in vec4 corner;
+layout(location = 1) in vec2 source;
+
+uniform mat4 v_mvp;
+
+out vec2 f_diff;
+
+// defined in kernel.glsl
+float kernel_support();
+
+void main() {
+  // one quad per source, just large enough to cover the kernel
+  f_diff = corner.xy * kernel_support();
+  gl_Position = v_mvp * vec4(source + f_diff, 0, 1);
+}